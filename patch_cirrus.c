@@ -24,6 +24,13 @@
 #include <sound/core.h>
 #include <sound/tlv.h>
 #include <linux/ctype.h>
+#include <linux/regmap.h>
+#include <linux/i2c.h>
+#include <linux/ktime.h>
+#include <linux/debugfs.h>
+#include <linux/seq_file.h>
+#include <linux/firmware.h>
+#include <linux/completion.h>
 #include "hda_codec.h"
 #include "hda_local.h"
 #include "hda_auto_parser.h"
@@ -33,6 +40,41 @@
 /*
  */
 
+// vendor node coefs shadowed by the coef cache (0x00-0x8f)
+#define CS8409_COEF_CACHE_SIZE 0x90
+
+// TDM slot table coefs - bit 15 clear means the slot is in use
+#define CS8409_TDM_SLOT_FIRST 0x19
+#define CS8409_TDM_SLOT_LAST 0x57
+#define CS8409_TDM_SLOTS (CS8409_TDM_SLOT_LAST - CS8409_TDM_SLOT_FIRST + 1)
+
+// TDM path/amp state for the warm start in cs_8409_play_setup
+enum {
+	CS8409_PLAY_OFF,		// path down - needs the full setup
+	CS8409_PLAY_CONFIGURED,		// path and amps set up but amps disabled
+	CS8409_PLAY_ENABLED,		// amps running
+};
+
+// sequences that can be replaced by the board firmware file
+enum {
+	CS8409_FW_SEQ_BOOT,
+	CS8409_FW_SEQ_PLAY,
+	CS8409_FW_SEQ_PLAYSTOP,
+	CS8409_FW_SEQ_MAX
+};
+
+// CS8409 speaker amp on the codec i2c bus
+struct cs8409_amp {
+	struct hda_codec *codec;
+	struct regmap *regmap;
+	unsigned int address;
+	unsigned int paged;
+	int primed;
+	// the amp has been reset behind the cache - see cs_8409_amp_regmap_restore
+	int dirty;
+	char name[8];
+};
+
 struct cs_spec {
 	struct hda_gen_spec gen;
 
@@ -67,6 +109,104 @@ struct cs_spec {
 	struct timespec first_play_time;
 	int playing;
 
+	// state of the TDM path/amps and the stream format they were set up for
+	// - see cs_8409_play_setup
+	// play_mutex covers them and the amp/TDM sequences that change them
+	// (prepare, cleanup, the trigger amp_work, pre-warm, idle shutdown)
+	// never held over a drain of i2c_wq - the queued work takes it
+	struct mutex play_mutex;
+	int play_state;
+	unsigned int play_format;
+	// the pre-warm or idle shutdown running the sequences from a worker
+	// leaves the converter cleanup in the hda core to the next prepare
+	// - see cs_8409_play_cvt_stop
+	int play_in_worker;
+	int play_cvt_resync;
+	// full shutdown after the stream has been idle for play_idle_ms
+	// on i2c_wq (holds a power reference while pending)
+	struct delayed_work play_off_work;
+	// amp/TDM setup started at the pcm open - see cs_8409_play_prewarm
+	struct work_struct prewarm_work;
+	// amp enable/disable from the pcm trigger - see cs_8409_play_trigger
+	struct work_struct amp_work;
+	atomic_t amp_want;
+
+	// CS8409 speaker amps - MAX98706 on 14,3 SSM3515 on 14,1
+	struct cs8409_amp amps[4];
+	int num_amps;
+
+	struct hda_codec *codec;
+
+	// keeps coef index/data verb groups together
+	struct mutex coef_mutex;
+	// coef index currently selected on the vendor node (-1 unknown)
+	int coef_idx;
+	// coef index auto increments on PROC_COEF access (-1 not probed yet)
+	int coef_autoinc;
+	// a range op is running - the auto incremented index is only tracked there
+	int coef_range;
+	// shadow of the vendor node coefs - see cs_8409_vendor_coef_read_cached
+	unsigned int coef_cache[CS8409_COEF_CACHE_SIZE];
+	DECLARE_BITMAP(coef_cache_valid, CS8409_COEF_CACHE_SIZE);
+	DECLARE_BITMAP(coef_cache_dirty, CS8409_COEF_CACHE_SIZE);
+	// TDM slot occupancy as last read or written - see cs_8409_vendor_tdm_in_use
+	DECLARE_BITMAP(tdm_slot_used, CS8409_TDM_SLOTS);
+	DECLARE_BITMAP(tdm_slot_known, CS8409_TDM_SLOTS);
+	// ordered queue for background i2c/coef work
+	struct workqueue_struct *i2c_wq;
+
+	// serialises use of the coef 0x59-0x5e i2c engine
+	struct mutex i2c_mutex;
+	// i2c clock (coef 0 bit 3) users and delayed disable
+	int i2c_clk_users;
+	int i2c_clk_on;
+	struct delayed_work i2c_clk_work;
+	// device address last latched in coef 0x59
+	unsigned int i2c_address;
+	// last page selected per 8 bit i2c address (index address >> 1)
+	DECLARE_BITMAP(i2c_page_valid, 128);
+	u8 i2c_page[128];
+#if IS_ENABLED(CONFIG_I2C)
+	struct i2c_adapter i2c_adap;
+	int i2c_adap_added;
+#endif
+
+	// i2c completion wait statistics - see i2c_wait_stats in debugfs
+	unsigned int i2c_wait_count;
+	unsigned int i2c_wait_timeouts;
+	unsigned int i2c_wait_peak_us;
+	u64 i2c_wait_total_us;
+	unsigned int i2c_wait_hist[8];
+
+	struct dentry *debugfs_root;
+
+	// amp/TDM bring up runs on i2c_wq after the pcms are built - see cs_8409_boot_queue
+	struct work_struct boot_work;
+	struct completion boot_done;
+	int boot_queued;
+	int boot_err;
+
+	// checking of the logged reads in the replayed sequences - see cs_8409_seq_verify_sample
+	unsigned int seq_verify;
+	unsigned int seq_verify_interval;
+	unsigned int seq_verify_count;
+	// read check statistics - see seq_verify_stats in debugfs
+	unsigned int seq_checks;
+	unsigned int seq_mismatches;
+	unsigned int seq_skipped;
+	unsigned int seq_last_srcidx;
+	unsigned int seq_last_val;
+	unsigned int seq_last_expected;
+
+	// sequences from cs8409-<subsystem id>.bin - see cs_8409_fw_request
+	struct mutex fw_mutex;
+	struct hda_coef *fw_seq[CS8409_FW_SEQ_MAX];
+	int fw_nseq[CS8409_FW_SEQ_MAX];
+	struct completion fw_done;
+	int fw_requested;
+	// firmware boot sequence waiting for the next full play setup (under fw_mutex)
+	int fw_boot_pending;
+
 };
 
 /* available models with CS420x */
@@ -1285,7 +1425,7 @@ enum {
 
 
 static void cs_8409_pcm_playback_pre_prepare_hook(struct hda_pcm_stream *hinfo, struct hda_codec *codec, struct snd_pcm_substream *substream,
-                               int action);
+                               unsigned int format, int action);
 
 // this is a copy from playback_pcm_prepare in hda_generic.c
 // we need to do the Apple setup BEFORE the snd_hda_multi_out_analog_prepare
@@ -1304,6 +1444,10 @@ static void cs_8409_pcm_playback_pre_prepare_hook(struct hda_pcm_stream *hinfo,
 // (the HDA specs say the node format setup must match the data)
 // if we do the Apple setup and then the snd_hda_multi_out_analog_prepare
 // the nodes will have the slightly different but working format
+// the Apple setup no longer writes the node format and stream id's at all
+// (it only clears them through the hda core cvt_setups cache for the
+// converter sync) so snd_hda_multi_out_analog_prepare writes the final
+// format and stream tag once
 static int cs_8409_playback_pcm_prepare(struct hda_pcm_stream *hinfo,
                                 struct hda_codec *codec,
                                 unsigned int stream_tag,
@@ -1315,7 +1459,7 @@ static int cs_8409_playback_pcm_prepare(struct hda_pcm_stream *hinfo,
         codec_dbg(codec, "cs_8409_playback_pcm_prepare\n");
 
         cs_8409_pcm_playback_pre_prepare_hook(hinfo, codec, substream,
-                               HDA_GEN_PCM_ACT_PREPARE);
+                               format, HDA_GEN_PCM_ACT_PREPARE);
 
         err = snd_hda_multi_out_analog_prepare(codec, &spec->multiout,
                                                stream_tag, format, substream);
@@ -1334,6 +1478,7 @@ static int cs_8409_playback_pcm_prepare(struct hda_pcm_stream *hinfo,
 }
 
 static void cs_8409_set_extended_codec_verb(void);
+static void cs_8409_vendor_coef_cache_flush(struct hda_codec *codec);
 
 static int cs_8409_init(struct hda_codec *codec)
 {
@@ -1353,6 +1498,10 @@ static int cs_8409_init(struct hda_codec *codec)
 
 	snd_hda_gen_init(codec);
 
+	// init is also the resume path - restore the vendor coefs lost at suspend
+	// that are safe to replay (the stream ones come back with the next play setup)
+	cs_8409_vendor_coef_cache_flush(codec);
+
 	// dump the rates/format of the afg node
 	// so analog_playback_stream is still NULL here - maybe only defined when doing actual playback
 	// the info stream is now defined
@@ -1432,6 +1581,8 @@ static int cs_8409_build_controls(struct hda_codec *codec)
 	return 0;
 }
 
+static void cs_8409_boot_queue(struct hda_codec *codec);
+
 int cs_8409_build_pcms(struct hda_codec *codec)
 {
 	int retval;
@@ -1440,6 +1591,10 @@ int cs_8409_build_pcms(struct hda_codec *codec)
 	//struct hda_pcm_stream *hinfo = NULL;
         printk("snd_hda_intel: cs_8409_build_pcms\n");
 	retval =  snd_hda_gen_build_pcms(codec);
+	// the amp/TDM bring up is slow (amp resets, i2c waits) so dont hold up
+	// the controller probe with it - the first prepare waits for it instead
+	if (!retval)
+		cs_8409_boot_queue(codec);
 	// we still dont have the pcm streams defined by here
 	// ah this is all done in snd_hda_codec_build_pcms
 	// which calls this patch routine or snd_hda_gen_build_pcms
@@ -1465,18 +1620,82 @@ void cs_8409_jack_unsol_event(struct hda_codec *codec, unsigned int res)
 }
 
 // have an explict one for 8409
-// cs_free is just a definition
-#define cs_8409_free		snd_hda_gen_free
+// need to release the amp regmaps before the generic free
+
+static void cs_8409_amps_free(struct hda_codec *codec);
+static void cs_8409_i2c_adapter_free(struct hda_codec *codec);
+
+static void cs_8409_debugfs_free(struct hda_codec *codec);
+static void cs_8409_fw_free(struct hda_codec *codec);
+
+static void cs_8409_vendor_i2c_clock_flush(struct hda_codec *codec, int powered);
+static void cs_8409_i2c_queue_drain(struct hda_codec *codec);
+static void cs_8409_i2c_queue_free(struct hda_codec *codec);
+
+static void cs_8409_boot_sync(struct hda_codec *codec);
+static void cs_8409_play_off_flush(struct hda_codec *codec, int pm);
+
+static void cs_8409_free(struct hda_codec *codec)
+{
+	cs_8409_play_off_flush(codec, 0);
+	cs_8409_boot_sync(codec);
+	cs_8409_fw_free(codec);
+	cs_8409_debugfs_free(codec);
+	cs_8409_i2c_adapter_free(codec);
+	cs_8409_i2c_queue_drain(codec);
+	cs_8409_i2c_queue_free(codec);
+	cs_8409_vendor_i2c_clock_flush(codec, 0);
+	cs_8409_amps_free(codec);
+	snd_hda_gen_free(codec);
+}
 
 
 // note this must come after any function definitions used
 
+#ifdef CONFIG_PM
+static void cs_8409_amps_mark_dirty(struct hda_codec *codec);
+static void cs_8409_vendor_coef_cache_mark_dirty(struct hda_codec *codec);
+
+// the amps lose their state (and page selection) while the codec is down
+static int cs_8409_suspend(struct hda_codec *codec)
+{
+	struct cs_spec *spec = codec->spec;
+
+        printk("snd_hda_intel: cs_8409_suspend\n");
+
+	// run a pending idle shutdown now - the drain below finishes
+	// the amp work it queues
+	cs_8409_play_off_flush(codec, 1);
+
+	cs_8409_i2c_queue_drain(codec);
+
+	cs_8409_vendor_i2c_clock_flush(codec, 1);
+
+	cs_8409_amps_mark_dirty(codec);
+
+	cs_8409_vendor_coef_cache_mark_dirty(codec);
+
+	// the TDM path and amps need a full setup after this
+	mutex_lock(&spec->play_mutex);
+	spec->play_state = CS8409_PLAY_OFF;
+	mutex_unlock(&spec->play_mutex);
+
+	// the vendor node coef index does not survive the power down
+	spec->coef_idx = -1;
+
+	return 0;
+}
+#endif
+
 static const struct hda_codec_ops cs_8409_patch_ops = {
 	.build_controls = cs_8409_build_controls,
 	.build_pcms = cs_8409_build_pcms,
 	.init = cs_8409_init,
 	.free = cs_8409_free,
 	.unsol_event = cs_8409_jack_unsol_event,
+#ifdef CONFIG_PM
+	.suspend = cs_8409_suspend,
+#endif
 };
 
 
@@ -1602,7 +1821,16 @@ static const struct hda_fixup cs8409_fixups[] = {
 };
 
 
-static int cs_8409_boot_setup(struct hda_codec *codec);
+static void cs_8409_boot_work(struct work_struct *work);
+static void cs_8409_play_off_work(struct work_struct *work);
+static void cs_8409_amp_work(struct work_struct *work);
+static void cs_8409_play_prewarm_work(struct work_struct *work);
+static int cs_8409_amps_init(struct hda_codec *codec);
+static int cs_8409_i2c_queue_init(struct hda_codec *codec);
+static void cs_8409_vendor_i2c_clock_work(struct work_struct *work);
+static void cs_8409_debugfs_init(struct hda_codec *codec);
+static void cs_8409_seq_verify_init(struct hda_codec *codec);
+static void cs_8409_fw_request(struct hda_codec *codec);
 
 static void cs_8409_playback_pcm_hook(struct hda_pcm_stream *hinfo,
                                       struct hda_codec *codec,
@@ -1634,6 +1862,22 @@ static int patch_cs8409(struct hda_codec *codec)
 
        spec->use_data = 0;
 
+       spec->codec = codec;
+       mutex_init(&spec->coef_mutex);
+       spec->coef_idx = -1;
+       spec->coef_autoinc = -1;
+       mutex_init(&spec->i2c_mutex);
+       INIT_DELAYED_WORK(&spec->i2c_clk_work, cs_8409_vendor_i2c_clock_work);
+       mutex_init(&spec->fw_mutex);
+       init_completion(&spec->fw_done);
+       INIT_WORK(&spec->boot_work, cs_8409_boot_work);
+       init_completion(&spec->boot_done);
+       mutex_init(&spec->play_mutex);
+       INIT_DELAYED_WORK(&spec->play_off_work, cs_8409_play_off_work);
+       INIT_WORK(&spec->amp_work, cs_8409_amp_work);
+       INIT_WORK(&spec->prewarm_work, cs_8409_play_prewarm_work);
+       cs_8409_seq_verify_init(codec);
+
        if (explicit)
 	      {
               //codec->patch_ops = cs_8409_patch_ops_explicit;
@@ -1781,10 +2025,27 @@ static int patch_cs8409(struct hda_codec *codec)
        //spec->gen.multiout.dac_nids[0] = 0x03;
        //spec->gen.multiout.dac_nids[1] = 0x00;
 
-       err = cs_8409_boot_setup(codec);
+       err = cs_8409_i2c_queue_init(codec);
        if (err < 0)
 	       goto error;
 
+       err = cs_8409_amps_init(codec);
+       if (err < 0)
+	       goto error;
+
+       // the boot setup itself runs later from cs_8409_build_pcms
+       // but only known boards have one
+       if (codec->core.subsystem_id != 0x106b3900 && codec->core.subsystem_id != 0x106b3300) {
+               printk("snd_hda_intel: UNKNOWN subsystem id 0x%08x",codec->core.subsystem_id);
+               err = -ENODEV;
+               goto error;
+       }
+
+       cs_8409_debugfs_init(codec);
+
+       // board sequence overrides arrive in the background
+       cs_8409_fw_request(codec);
+
        spec->play_init = 0;
 
        // init the last play time
@@ -1798,7 +2059,7 @@ static int patch_cs8409(struct hda_codec *codec)
        return 0;
 
  error:
-       cs_free(codec);
+       cs_8409_free(codec);
        return err;
 }
 
@@ -1826,24 +2087,30 @@ cs_8409_extended_codec_verb(struct hda_codec *codec, hda_nid_t nid,
 
         printk("snd_hda_intel: cs_8409_extended_codec_verb nid 0x%02x flags 0x%x verb 0x%03x parm 0x%04x\n", nid, flags, verb, parm);
 
+	// go through the amp regmaps so the cached DigitalVolCtrl stays in step
 	if ((verb & 0x0ff8) == 0xf78)
 	{
-		retval1 = cs_8409_vendor_i2cWrite(codec, 0x64, 0x2d, parm, 0);
-		retval2 = cs_8409_vendor_i2cWrite(codec, 0x62, 0x2d, parm, 0);
-		retval3 = cs_8409_vendor_i2cWrite(codec, 0x74, 0x2d, parm, 0);
-		retval4 = cs_8409_vendor_i2cWrite(codec, 0x72, 0x2d, parm, 0);
-
-		printk("snd_hda_intel: cs_8409_extended_codec_verb wr ret 1 0x%x\n",retval1);
-		printk("snd_hda_intel: cs_8409_extended_codec_verb wr ret 2 0x%x\n",retval2);
-		printk("snd_hda_intel: cs_8409_extended_codec_verb wr ret 3 0x%x\n",retval3);
-		printk("snd_hda_intel: cs_8409_extended_codec_verb wr ret 4 0x%x\n",retval4);
+		struct cs8409_i2c_op ops[] = {
+			{ 0, 0x2d, parm, 1, 0 },
+		};
+		int status[ARRAY_SIZE(cs_8409_max98706_addresses)];
+		int i;
+
+		// one i2c window for all four amps
+		cs_8409_amp_regmap_broadcast(codec, cs_8409_max98706_addresses, ARRAY_SIZE(cs_8409_max98706_addresses),
+		                             ops, ARRAY_SIZE(ops), 0, status);
+
+		for (i = 0; i < ARRAY_SIZE(status); i++)
+			printk("snd_hda_intel: cs_8409_extended_codec_verb wr amp 0x%02x ret %d\n",cs_8409_max98706_addresses[i],status[i]);
+
+		retval1 = status[0] ? -1 : 0;
 	}
 	else if ((verb & 0x0ff8) == 0xff8)
 	{
-		retval1 = cs_8409_vendor_i2cRead(codec, 0x64, 0x2d, 0);
-		retval2 = cs_8409_vendor_i2cRead(codec, 0x62, 0x2d, 0);
-		retval3 = cs_8409_vendor_i2cRead(codec, 0x74, 0x2d, 0);
-		retval4 = cs_8409_vendor_i2cRead(codec, 0x72, 0x2d, 0);
+		retval1 = cs_8409_amp_regmap_read_reg(codec, 0x64, 0x2d);
+		retval2 = cs_8409_amp_regmap_read_reg(codec, 0x62, 0x2d);
+		retval3 = cs_8409_amp_regmap_read_reg(codec, 0x74, 0x2d);
+		retval4 = cs_8409_amp_regmap_read_reg(codec, 0x72, 0x2d);
 
 		printk("snd_hda_intel: cs_8409_extended_codec_verb rd ret 1 0x%x\n",retval1);
 		printk("snd_hda_intel: cs_8409_extended_codec_verb rd ret 2 0x%x\n",retval2);
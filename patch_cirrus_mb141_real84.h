@@ -8,10 +8,15 @@ static void setup_amps_reset_i2c_ssm3(struct hda_codec *codec)
 //      snd_hda i2cWrite      i2c address 0x2c i2c            reg 0x0083 i2c data 0x0083   reg anal: PowerControl            : PowerDown SoftwareReset BVSenseOn AutoPwrOffEnabled
 //      snd_hda i2cWrite      i2c address 0x2e i2c            reg 0x0083 i2c data 0x0083   reg anal: PowerControl            : PowerDown SoftwareReset BVSenseOn AutoPwrOffEnabled
 
-        cs_8409_vendor_i2cWrite(codec, 0x28, 0x0000, 0x0083, 1); // snd_hda
-        cs_8409_vendor_i2cWrite(codec, 0x2a, 0x0000, 0x0083, 1); // snd_hda
-        cs_8409_vendor_i2cWrite(codec, 0x2c, 0x0000, 0x0083, 1); // snd_hda
-        cs_8409_vendor_i2cWrite(codec, 0x2e, 0x0000, 0x0083, 1); // snd_hda
+        static const struct cs8409_i2c_op ops[] = {
+                { 0, 0x0000, 0x0083, 1, 1 },
+        };
+        int status[ARRAY_SIZE(cs_8409_ssm3515_addresses)];
+
+        cs_8409_vendor_i2c_broadcast(codec, cs_8409_ssm3515_addresses, ARRAY_SIZE(cs_8409_ssm3515_addresses),
+                                     ops, ARRAY_SIZE(ops), status);
+
+        cs_8409_amps_mark_dirty(codec);
 
 }
 
@@ -217,7 +222,21 @@ static void cs_8409_boot_setup_real_ssm3(struct hda_codec *codec)
 }
 
 
-static void play_setup_amp_ssm3(struct hda_codec *codec, int amp_address, int amp_volume)
+// SSM3515 play setup register list - sent to each amp
+// and the 0x03 DACVolume data is replaced by the requested volume
+static const struct cs8409_i2c_op ssm3515_play_setup[] = {
+        { 0, 0x0005, 0x0000, 1, 1 },
+        { 0, 0x0001, 0x0011, 1, 1 },
+        { 0, 0x0003, 0x0048, 1, 1 },
+        { 0, 0x0004, 0x0051, 1, 1 },
+        { 0, 0x0002, 0x0000, 0, 1 },
+        { 0, 0x0002, 0x0032, 1, 1 },
+        { 0, 0x0002, 0x0000, 0, 1 },
+        { 0, 0x0002, 0x0032, 1, 1 },
+        { 0, 0x0000, 0x0000, 1, 1 },
+};
+
+static int play_setup_amp_ssm3(struct hda_codec *codec, const unsigned int *amp_addresses, int num_amps, int amp_volume)
 {
         //int retval;
 
@@ -232,22 +251,35 @@ static void play_setup_amp_ssm3(struct hda_codec *codec, int amp_address, int am
 //      snd_hda i2cWrite      i2c address 0x28 i2c            reg 0x0232 i2c data 0x0032   reg anal: DACControl              : 32-48kHz SampleRate DACLowPower DACHighPass DACSoftVol
 //      snd_hda i2cWrite      i2c address 0x28 i2c            reg 0x0000 i2c data 0x0000   reg anal: PowerControl            : PowerOn BVSenseOn
 
-        cs_8409_vendor_i2cWrite(codec, amp_address, 0x0005, 0x0000, 1); // snd_hda
-        cs_8409_vendor_i2cWrite(codec, amp_address, 0x0001, 0x0011, 1); // snd_hda
-        cs_8409_vendor_i2cWrite(codec, amp_address, 0x0003, amp_volume, 1); // snd_hda
-        cs_8409_vendor_i2cWrite(codec, amp_address, 0x0004, 0x0051, 1); // snd_hda
-        cs_8409_vendor_i2cRead(codec, amp_address, 0x0002, 1); // snd_hda
-        cs_8409_vendor_i2cWrite(codec, amp_address, 0x0002, 0x0032, 1); // snd_hda
-        cs_8409_vendor_i2cRead(codec, amp_address, 0x0002, 1); // snd_hda
-        cs_8409_vendor_i2cWrite(codec, amp_address, 0x0002, 0x0032, 1); // snd_hda
-        cs_8409_vendor_i2cWrite(codec, amp_address, 0x0000, 0x0000, 1); // snd_hda
+        struct cs8409_i2c_op ops[ARRAY_SIZE(ssm3515_play_setup)];
+        int status[4];
+        int err;
+        int i;
+
+        for (i = 0; i < ARRAY_SIZE(ssm3515_play_setup); i++) {
+                ops[i] = ssm3515_play_setup[i];
+                if (ops[i].write && ops[i].reg == 0x0003)
+                        ops[i].data = amp_volume;
+        }
+
+        if (WARN_ON(num_amps > ARRAY_SIZE(status)))
+                return -EINVAL;
 
+        err = cs_8409_amp_regmap_broadcast(codec, amp_addresses, num_amps, ops, ARRAY_SIZE(ops), 1, status);
+
+        for (i = 0; i < num_amps; i++)
+                if (status[i])
+                        codec_err(codec, "amp 0x%02x play setup failed %d\n", amp_addresses[i], status[i]);
+
+        return err;
 }
 
 
-static void cs_8409_play_real_ssm3(struct hda_codec *codec)
+static int cs_8409_play_real_ssm3(struct hda_codec *codec)
 {
         int retval;
+        int err;
+        int err34;
         //int retval1;
         //int retval2;
 
@@ -271,7 +303,7 @@ static void cs_8409_play_real_ssm3(struct hda_codec *codec)
         //play_setup_amps12_ssm3(codec);
 
         // we select the amp addresses in this function
-        play_setup_amps12(codec);
+        err = play_setup_amps12(codec);
 
 
         // all evidence is this is identical to MB 14,3 version
@@ -282,7 +314,7 @@ static void cs_8409_play_real_ssm3(struct hda_codec *codec)
         //play_setup_amps34_ssm3(codec);
 
         // we select the amp addresses in this function
-        play_setup_amps34(codec);
+        err34 = play_setup_amps34(codec);
 
 
         // all evidence is this is identical to MB 14,3 version
@@ -293,6 +325,7 @@ static void cs_8409_play_real_ssm3(struct hda_codec *codec)
 
         printk("snd_hda_intel: command nid cs_8409_play_real_ssm3 end");
 
+        return err < 0 ? err : err34;
 }
 
 
@@ -303,7 +336,11 @@ static void playstop_disable_amp_ssm3(struct hda_codec *codec, int amp_address)
 //      snd_hda: # i2cWrite: 
 //      snd_hda i2cWrite      i2c address 0x2c i2c            reg 0x0001 i2c data 0x0001   reg anal: PowerControl            : PowerDown BVSenseOn
 
-        cs_8409_vendor_i2cWrite(codec, amp_address, 0x0000, 0x0001, 1); // snd_hda
+        struct cs8409_i2c_op ops[] = {
+                { amp_address, 0x0000, 0x0001, 1, 1 },
+        };
+
+        cs_8409_amp_regmap_sequence(codec, amp_address, ops, ARRAY_SIZE(ops), 0);
 
 }
 
@@ -327,14 +364,9 @@ static void cs_8409_playstop_real_ssm3(struct hda_codec *codec)
         playstop_disable_TDM_amps34(codec);
 
         // for some reason Apple duplicates the amp disable here??
+        // queued along with the AFG power down - see cs_8409_playstop_real
 
-        playstop_disable_amps12(codec);
-
-        playstop_disable_amps34(codec);
-
-
-        //snd_hda_codec_write(codec, codec->core.afg, 0, AC_VERB_SET_POWER_STATE, 0x00000003); // 0x00170503
-        hda_set_node_power_state(codec, codec->core.afg, AC_PWRST_D3);
+        playstop_queue_amps_disable(codec);
 
         //retval = snd_hda_codec_read_check(codec, 0x22, 0, AC_VERB_GET_POWER_STATE, 0x00000000, 0x00000033, 1636); // 0x022f0500
         //retval = snd_hda_codec_read_check(codec, 0x23, 0, AC_VERB_GET_POWER_STATE, 0x00000000, 0x00000033, 1637); // 0x023f0500
@@ -109,286 +109,1890 @@ static void hda_check_power_state(struct hda_codec *codec, hda_nid_t nid, int fl
 
 // go with Apple way??
 // this always does a get with index 0 initially and terminates with a set to 0 finally
+// that is kept as coef_strict - by default we track the coef index of the
+// vendor node instead and only set it when it is not already selected
+// the dummy get and the reset to index 0 are dropped
+// the index is only known after an access once cs_8409_vendor_coef_probe_autoinc
+// has found whether a PROC_COEF access moves it - until then every access
+// selects its index (so the saving is just the dummy get and the reset)
+
+static bool coef_strict;
+module_param(coef_strict, bool, 0644);
+MODULE_PARM_DESC(coef_strict, "CS8409 Apple style coef access - sync read and index reset around every access");
+
+// forget the tracked index - after a codec reset or resume
+static inline void cs_8409_vendor_coef_index_invalidate(struct hda_codec *codec)
+{
+        struct cs_spec *spec = codec->spec;
+        spec->coef_idx = -1;
+}
+
+// select coef index idx - called with coef_mutex held
+static inline void cs_8409_vendor_coef_select(struct hda_codec *codec, unsigned int idx)
+{
+        struct cs_spec *spec = codec->spec;
+
+        if (coef_strict) {
+                snd_hda_codec_read(codec, spec->vendor_nid, 0,
+                                    AC_VERB_GET_COEF_INDEX, 0);
+        }
+        else if (spec->coef_idx == idx)
+                return;
+
+        snd_hda_codec_write(codec, spec->vendor_nid, 0,
+                            AC_VERB_SET_COEF_INDEX, idx);
+        spec->coef_idx = idx;
+}
+
+// a PROC_COEF access has been done - called with coef_mutex held
+static inline void cs_8409_vendor_coef_accessed(struct hda_codec *codec)
+{
+        struct cs_spec *spec = codec->spec;
+
+        if (coef_strict) {
+                snd_hda_codec_write(codec, spec->vendor_nid, 0,
+                                    AC_VERB_SET_COEF_INDEX, 0);
+                spec->coef_idx = 0;
+                return;
+        }
+
+        // with auto increment probed the index has moved on to the next coef
+        // - only followed inside a range op where the final index is checked
+        // without it stays where it is (so a poll of the same coef, eg the
+        // i2c status 0x5c, needs no more index writes) - and if the probe has
+        // not been done we dont know where it is so select it again next time
+        if (spec->coef_autoinc == 1 && spec->coef_range && spec->coef_idx >= 0)
+                spec->coef_idx++;
+        else if (spec->coef_autoinc != 0)
+                spec->coef_idx = -1;
+}
+
+// TDM slot occupancy
+// AppleHDATDMBusManagerCS8409::tdmInUse scans the whole slot table 0x19-0x57 on
+// every TDM setup and teardown - instead keep the bit 15 state of each slot from
+// the coef reads and writes that go to the codec
+// tdm_scan re-reads the table from the codec and checks it against the bitmap
+
+static bool tdm_scan;
+module_param(tdm_scan, bool, 0644);
+MODULE_PARM_DESC(tdm_scan, "CS8409 debug - scan the TDM slot coefs instead of using the tracked slot state");
+
+// called with coef_mutex held
+static inline void cs_8409_vendor_tdm_slot_track(struct hda_codec *codec, unsigned int idx,
+                                      unsigned int coef)
+{
+        struct cs_spec *spec = codec->spec;
+        unsigned int slot;
+
+        if (idx < CS8409_TDM_SLOT_FIRST || idx > CS8409_TDM_SLOT_LAST)
+                return;
+        slot = idx - CS8409_TDM_SLOT_FIRST;
+
+        if (coef & 0x8000)
+                clear_bit(slot, spec->tdm_slot_used);
+        else
+                set_bit(slot, spec->tdm_slot_used);
+        set_bit(slot, spec->tdm_slot_known);
+}
+
+// 1 if any TDM slot is in use, 0 if none or -1 if some slot state is not known
+static int cs_8409_vendor_tdm_in_use(struct hda_codec *codec)
+{
+        struct cs_spec *spec = codec->spec;
+        int in_use;
+
+        mutex_lock(&spec->coef_mutex);
+        if (!bitmap_full(spec->tdm_slot_known, CS8409_TDM_SLOTS))
+                in_use = -1;
+        else
+                in_use = !bitmap_empty(spec->tdm_slot_used, CS8409_TDM_SLOTS);
+        mutex_unlock(&spec->coef_mutex);
+
+        return in_use;
+}
+
+// raw coef accesses - called with coef_mutex held
+
+static unsigned int cs_8409_vendor_coef_read_hw(struct hda_codec *codec, unsigned int idx)
+{
+        struct cs_spec *spec = codec->spec;
+        unsigned int retval;
+        cs_8409_vendor_coef_select(codec, idx);
+        retval = snd_hda_codec_read(codec, spec->vendor_nid, 0,
+                                  AC_VERB_GET_PROC_COEF, 0);
+        cs_8409_vendor_coef_accessed(codec);
+        if (retval != -1)
+                cs_8409_vendor_tdm_slot_track(codec, idx, retval);
+        return retval;
+}
+
+static void cs_8409_vendor_coef_write_hw(struct hda_codec *codec, unsigned int idx,
+                                      unsigned int coef)
+{
+        struct cs_spec *spec = codec->spec;
+        cs_8409_vendor_coef_select(codec, idx);
+        snd_hda_codec_write(codec, spec->vendor_nid, 0,
+                            AC_VERB_SET_PROC_COEF, coef);
+        cs_8409_vendor_coef_accessed(codec);
+        // appears to return 0
+
+        cs_8409_vendor_tdm_slot_track(codec, idx, coef);
+
+        // coef 0 bit 3 is the i2c clock enable - the Apple sequences write it directly
+        if (idx == 0x0)
+                spec->i2c_clk_on = !!(coef & 0x8);
+}
+
+// shadow cache of the vendor node coefs
+// the Apple sequences re-read and re-write a lot of coefs (0x6b, 0x71, the TDM
+// slots..) with values they already hold - reads of cached coefs are served
+// from the shadow and writes of an unchanged value are dropped
+// entries go dirty when the codec powers down and cs_8409_vendor_coef_cache_flush
+// at resume writes back the ones safe to replay
+
+static bool coef_cache = 1;
+module_param(coef_cache, bool, 0644);
+MODULE_PARM_DESC(coef_cache, "CS8409 shadow vendor node coefs and skip unchanged coef writes");
+
+// only the configuration coefs that just hold what was last written are
+// shadowed - the TDM slot table, the TDM bus setup 0x6b/0x71 and 0x82
+// everything else is volatile - the i2c engine coefs change under us and
+// writes to control coefs such as 0x00 (i2c clock) or 0x17 (converter sync)
+// act on the hardware so the repeated writes of the Apple sequences must go out
+static inline int cs_8409_vendor_coef_volatile(unsigned int idx)
+{
+        if (idx >= CS8409_TDM_SLOT_FIRST && idx <= CS8409_TDM_SLOT_LAST)
+                return 0;
+        switch (idx) {
+        case 0x6b:
+        case 0x71:
+        case 0x82:
+                return 0;
+        }
+        return 1;
+}
+
+// shadowed coefs safe to write back at resume - the TDM bus setup is the
+// same for every stream while the slot table and 0x82 describe an active
+// stream (the play setup programs them again)
+static inline int cs_8409_vendor_coef_restorable(unsigned int idx)
+{
+        return idx == 0x6b || idx == 0x71;
+}
+
+static unsigned int cs_8409_vendor_coef_read_cached(struct hda_codec *codec, unsigned int idx)
+{
+        struct cs_spec *spec = codec->spec;
+        unsigned int retval;
+
+        if (!coef_cache || cs_8409_vendor_coef_volatile(idx))
+                return cs_8409_vendor_coef_read_hw(codec, idx);
+
+        if (test_bit(idx, spec->coef_cache_valid))
+                return spec->coef_cache[idx];
+
+        retval = cs_8409_vendor_coef_read_hw(codec, idx);
+        if (retval != -1) {
+                spec->coef_cache[idx] = retval;
+                set_bit(idx, spec->coef_cache_valid);
+        }
+        return retval;
+}
+
+static void cs_8409_vendor_coef_write_cached(struct hda_codec *codec, unsigned int idx,
+                                      unsigned int coef)
+{
+        struct cs_spec *spec = codec->spec;
+
+        if (cs_8409_vendor_coef_volatile(idx)) {
+                cs_8409_vendor_coef_write_hw(codec, idx, coef);
+                return;
+        }
+
+        if (!coef_cache) {
+                // dont leave a stale shadow behind if the cache is re-enabled
+                clear_bit(idx, spec->coef_cache_valid);
+                clear_bit(idx, spec->coef_cache_dirty);
+                cs_8409_vendor_coef_write_hw(codec, idx, coef);
+                return;
+        }
+
+        if (test_bit(idx, spec->coef_cache_valid) &&
+            !test_bit(idx, spec->coef_cache_dirty) &&
+            spec->coef_cache[idx] == coef)
+                return;
+
+        cs_8409_vendor_coef_write_hw(codec, idx, coef);
+        spec->coef_cache[idx] = coef;
+        set_bit(idx, spec->coef_cache_valid);
+        clear_bit(idx, spec->coef_cache_dirty);
+}
+
+// forget the shadow - after a codec reset
+static void cs_8409_vendor_coef_cache_invalidate(struct hda_codec *codec)
+{
+        struct cs_spec *spec = codec->spec;
+        mutex_lock(&spec->coef_mutex);
+        bitmap_zero(spec->coef_cache_valid, CS8409_COEF_CACHE_SIZE);
+        bitmap_zero(spec->coef_cache_dirty, CS8409_COEF_CACHE_SIZE);
+        bitmap_zero(spec->tdm_slot_known, CS8409_TDM_SLOTS);
+        mutex_unlock(&spec->coef_mutex);
+}
+
+// the codec is going down - the hardware no longer holds the shadowed values
+static void cs_8409_vendor_coef_cache_mark_dirty(struct hda_codec *codec)
+{
+        struct cs_spec *spec = codec->spec;
+        mutex_lock(&spec->coef_mutex);
+        bitmap_copy(spec->coef_cache_dirty, spec->coef_cache_valid, CS8409_COEF_CACHE_SIZE);
+        mutex_unlock(&spec->coef_mutex);
+}
+
+// write back the dirty coefs that are safe to replay (in index order)
+// the rest are dropped from the shadow and read from the codec next time
+static void cs_8409_vendor_coef_cache_flush(struct hda_codec *codec)
+{
+        struct cs_spec *spec = codec->spec;
+        unsigned int idx;
+        int nflushed = 0;
+
+        mutex_lock(&spec->coef_mutex);
+        for_each_set_bit(idx, spec->coef_cache_dirty, CS8409_COEF_CACHE_SIZE) {
+                if (!cs_8409_vendor_coef_restorable(idx)) {
+                        clear_bit(idx, spec->coef_cache_valid);
+                        if (idx >= CS8409_TDM_SLOT_FIRST && idx <= CS8409_TDM_SLOT_LAST)
+                                clear_bit(idx - CS8409_TDM_SLOT_FIRST, spec->tdm_slot_known);
+                        continue;
+                }
+                cs_8409_vendor_coef_write_hw(codec, idx, spec->coef_cache[idx]);
+                nflushed++;
+        }
+        bitmap_zero(spec->coef_cache_dirty, CS8409_COEF_CACHE_SIZE);
+        mutex_unlock(&spec->coef_mutex);
+
+        if (nflushed)
+                codec_dbg(codec, "coef cache flushed %d coefs\n", nflushed);
+}
+
+// coef_mutex keeps each index/data verb group together now that the i2c
+// queue can run coef accesses from its worker
+
+static inline unsigned int cs_8409_vendor_coef_get(struct hda_codec *codec, unsigned int idx)
+{
+        struct cs_spec *spec = codec->spec;
+        unsigned int retval;
+        mutex_lock(&spec->coef_mutex);
+        retval = cs_8409_vendor_coef_read_cached(codec, idx);
+        mutex_unlock(&spec->coef_mutex);
+        return retval;
+}
+
+// read the hardware even if the coef is shadowed - for dumps
+static inline unsigned int cs_8409_vendor_coef_get_uncached(struct hda_codec *codec, unsigned int idx)
+{
+        struct cs_spec *spec = codec->spec;
+        unsigned int retval;
+        mutex_lock(&spec->coef_mutex);
+        retval = cs_8409_vendor_coef_read_hw(codec, idx);
+        mutex_unlock(&spec->coef_mutex);
+        return retval;
+}
+
+static inline void cs_8409_vendor_coef_set(struct hda_codec *codec, unsigned int idx,
+                                      unsigned int coef)
+{
+        struct cs_spec *spec = codec->spec;
+        mutex_lock(&spec->coef_mutex);
+        cs_8409_vendor_coef_write_cached(codec, idx, coef);
+        mutex_unlock(&spec->coef_mutex);
+}
+
+// masked read-modify-write of a coef under one hold of coef_mutex
+// new = (old & ~mask) | (coef & mask) - the write is skipped if nothing changes
+// returns 1 if written, 0 if unchanged or -EIO if the read failed
+// old_coef/new_coef (either may be NULL) return the values before and after
+static int cs_8409_vendor_coef_update(struct hda_codec *codec, unsigned int idx,
+                                      unsigned int coef, unsigned int mask,
+                                      unsigned int *old_coef, unsigned int *new_coef)
+{
+        struct cs_spec *spec = codec->spec;
+        unsigned int oldval, newval;
+        int ret = 0;
+
+        mutex_lock(&spec->coef_mutex);
+        oldval = cs_8409_vendor_coef_read_cached(codec, idx);
+        if (oldval == -1) {
+                newval = oldval;
+                ret = -EIO;
+        }
+        else {
+                newval = (oldval & ~mask) | (coef & mask);
+                // a dirty shadow entry still has to reach the codec
+                if (newval != oldval ||
+                    (idx < CS8409_COEF_CACHE_SIZE && test_bit(idx, spec->coef_cache_dirty))) {
+                        cs_8409_vendor_coef_write_cached(codec, idx, newval);
+                        ret = 1;
+                }
+        }
+        mutex_unlock(&spec->coef_mutex);
+
+        if (old_coef)
+                *old_coef = oldval;
+        if (new_coef)
+                *new_coef = newval;
+        return ret;
+}
+
+static inline unsigned int cs_8409_vendor_coef_set_mask(struct hda_codec *codec, unsigned int idx,
+                                      unsigned int coef, unsigned int mask)
+{
+        unsigned int retval;
+        cs_8409_vendor_coef_update(codec, idx, coef, mask, &retval, NULL);
+        // lets return the read value for checking
+        return retval;
+}
+
+// bulk coef access for contiguous ranges (TDM slot table 0x19-0x57, dumps)
+// HDA vendor widgets commonly auto increment the coef index on each PROC_COEF
+// access - if the CS8409 does the whole range needs only one SET_COEF_INDEX
+// and the per coef index tracking above just carries on from coef to coef
+// this is probed once at boot and the final index of each range is checked
+// so that a wrong guess drops us back to selecting each coef
+
+// probe index auto increment on a read and a write of coef 0x19
+// the write puts back the value just read - run from the boot setup before
+// the TDM slot table is set up so it cannot race a live slot
+static void cs_8409_vendor_coef_probe_autoinc(struct hda_codec *codec)
+{
+        struct cs_spec *spec = codec->spec;
+        unsigned int val, rd_idx, wr_idx;
+
+        mutex_lock(&spec->coef_mutex);
+
+        if (spec->coef_autoinc >= 0)
+                goto out;
+
+        snd_hda_codec_write(codec, spec->vendor_nid, 0, AC_VERB_SET_COEF_INDEX, 0x19);
+        val = snd_hda_codec_read(codec, spec->vendor_nid, 0, AC_VERB_GET_PROC_COEF, 0);
+        rd_idx = snd_hda_codec_read(codec, spec->vendor_nid, 0, AC_VERB_GET_COEF_INDEX, 0);
+
+        spec->coef_idx = -1;
+
+        if (val == -1) {
+                spec->coef_autoinc = 0;
+                goto out;
+        }
+
+        cs_8409_vendor_tdm_slot_track(codec, 0x19, val);
+
+        snd_hda_codec_write(codec, spec->vendor_nid, 0, AC_VERB_SET_COEF_INDEX, 0x19);
+        snd_hda_codec_write(codec, spec->vendor_nid, 0, AC_VERB_SET_PROC_COEF, val);
+        wr_idx = snd_hda_codec_read(codec, spec->vendor_nid, 0, AC_VERB_GET_COEF_INDEX, 0);
+
+        spec->coef_autoinc = (rd_idx == 0x1a && wr_idx == 0x1a);
+
+        dev_info(hda_codec_dev(codec), "cs8409 coef index auto increment %s (read 0x%02x write 0x%02x)\n",
+                 spec->coef_autoinc ? "on" : "off", rd_idx, wr_idx);
+out:
+        mutex_unlock(&spec->coef_mutex);
+}
+
+// check the index the codec ended up at is the one we tracked - called with coef_mutex held
+// returns 0 if the tracking held or nothing can be checked
+static int cs_8409_vendor_coef_range_verify(struct hda_codec *codec)
+{
+        struct cs_spec *spec = codec->spec;
+        unsigned int hw_idx;
+
+        if (coef_strict || spec->coef_autoinc != 1 || spec->coef_idx < 0)
+                return 0;
+
+        hw_idx = snd_hda_codec_read(codec, spec->vendor_nid, 0, AC_VERB_GET_COEF_INDEX, 0);
+        if (hw_idx == spec->coef_idx)
+                return 0;
+
+        codec_err(codec, "cs8409 coef index 0x%02x expected 0x%02x - auto increment off\n",
+                  hw_idx, spec->coef_idx);
+        spec->coef_autoinc = 0;
+        spec->coef_idx = -1;
+        return -EIO;
+}
+
+// read count coefs from first into vals
+// cached reads come from the coef shadow where possible
+static int cs_8409_vendor_coef_read_range(struct hda_codec *codec, unsigned int first,
+                                          unsigned int count, unsigned int *vals, int cached)
+{
+        struct cs_spec *spec = codec->spec;
+        unsigned int i;
+        int err;
+
+        mutex_lock(&spec->coef_mutex);
+        spec->coef_range = 1;
+
+        for (i = 0; i < count; i++) {
+                if (cached)
+                        vals[i] = cs_8409_vendor_coef_read_cached(codec, first + i);
+                else
+                        vals[i] = cs_8409_vendor_coef_read_hw(codec, first + i);
+        }
+
+        err = cs_8409_vendor_coef_range_verify(codec);
+        if (err) {
+                // the values may be from the wrong coefs - drop any we shadowed and read again
+                for (i = 0; i < count && first + i < CS8409_COEF_CACHE_SIZE; i++) {
+                        if (!test_bit(first + i, spec->coef_cache_dirty))
+                                clear_bit(first + i, spec->coef_cache_valid);
+                }
+                for (i = 0; i < count; i++) {
+                        if (cached)
+                                vals[i] = cs_8409_vendor_coef_read_cached(codec, first + i);
+                        else
+                                vals[i] = cs_8409_vendor_coef_read_hw(codec, first + i);
+                }
+        }
+
+        spec->coef_range = 0;
+        mutex_unlock(&spec->coef_mutex);
+        return err;
+}
+
+// write count coefs from first - from vals or all set to fill if vals is NULL
+static int cs_8409_vendor_coef_write_range_fill(struct hda_codec *codec, unsigned int first,
+                                                unsigned int count, const unsigned int *vals,
+                                                unsigned int fill)
+{
+        struct cs_spec *spec = codec->spec;
+        unsigned int i;
+        int err;
+
+        mutex_lock(&spec->coef_mutex);
+        spec->coef_range = 1;
+
+        for (i = 0; i < count; i++)
+                cs_8409_vendor_coef_write_cached(codec, first + i, vals ? vals[i] : fill);
+
+        err = cs_8409_vendor_coef_range_verify(codec);
+        if (err) {
+                // some writes may have landed on the wrong coefs - write the range again one by one
+                for (i = 0; i < count; i++)
+                        cs_8409_vendor_coef_write_hw(codec, first + i, vals ? vals[i] : fill);
+        }
+
+        spec->coef_range = 0;
+        mutex_unlock(&spec->coef_mutex);
+        return err;
+}
+
+static inline int cs_8409_vendor_coef_write_range(struct hda_codec *codec, unsigned int first,
+                                                  unsigned int count, const unsigned int *vals)
+{
+        return cs_8409_vendor_coef_write_range_fill(codec, first, count, vals, 0);
+}
+
+static inline int cs_8409_vendor_coef_fill_range(struct hda_codec *codec, unsigned int first,
+                                                 unsigned int count, unsigned int fill)
+{
+        return cs_8409_vendor_coef_write_range_fill(codec, first, count, NULL, fill);
+}
+
+static inline void cs_8409_vendor_enableI2Cclock(struct hda_codec *codec, unsigned int flag)
+{
+	// coef 0 bit 3 - the read-modify-write is done under coef_mutex as the
+	// sequences also write coef 0 (outside i2c_mutex)
+	cs_8409_vendor_coef_update(codec, 0x0, flag ? 0x8 : 0x0, 0x8, NULL, NULL);
+}
+
+
+// define i2cRead and i2cWrite functions
+// following Apple
+
+// AppleHDAFunctionGroupCS8409::_i2cRead/_i2cWrite split into their phases
+// so that a batch of transactions can share the power check, proc state,
+// i2c clock enable and the device address latch (coef 0x59)
+// the per transaction part is just the page/register/data writes to
+// coefs 0x5d/0x5e and the completion polling of coef 0x5c
+
+// i2c completion wait tuning
+// a byte at 100kHz is tens of us and each coef 0x5c poll is already an hda
+// verb round trip - so poll back to back for a few reads then back off
+// exponentially from i2c_wait_min_us up to i2c_wait_max_us
+// a transaction not done by i2c_wait_timeout_us fails with -ETIMEDOUT
+static unsigned int i2c_wait_spin = 4;
+module_param(i2c_wait_spin, uint, 0644);
+MODULE_PARM_DESC(i2c_wait_spin, "CS8409 i2c done polls before sleeping");
+
+static unsigned int i2c_wait_min_us = 10;
+module_param(i2c_wait_min_us, uint, 0644);
+MODULE_PARM_DESC(i2c_wait_min_us, "CS8409 i2c done poll first backoff (us)");
+
+static unsigned int i2c_wait_max_us = 1000;
+module_param(i2c_wait_max_us, uint, 0644);
+MODULE_PARM_DESC(i2c_wait_max_us, "CS8409 i2c done poll max backoff (us)");
+
+static unsigned int i2c_wait_timeout_us = 20000;
+module_param(i2c_wait_timeout_us, uint, 0644);
+MODULE_PARM_DESC(i2c_wait_timeout_us, "CS8409 i2c transaction timeout (us)");
+
+// record the wait time of each transaction - histogram buckets are
+// <16us, <32us, <64us ... >=1024us
+static void cs_8409_vendor_i2c_wait_account(struct hda_codec *codec, s64 wait_us, int polls, int err)
+{
+	struct cs_spec *spec = codec->spec;
+	int bucket;
+
+	if (wait_us < 0)
+		wait_us = 0;
+
+	spec->i2c_wait_count++;
+	spec->i2c_wait_total_us += wait_us;
+	if (wait_us > spec->i2c_wait_peak_us)
+		spec->i2c_wait_peak_us = wait_us;
+	if (err == -ETIMEDOUT)
+		spec->i2c_wait_timeouts++;
+
+	bucket = fls(wait_us >> 4);
+	if (bucket >= ARRAY_SIZE(spec->i2c_wait_hist))
+		bucket = ARRAY_SIZE(spec->i2c_wait_hist) - 1;
+	spec->i2c_wait_hist[bucket]++;
+
+	codec_dbg(codec, "i2c wait %lld us %d polls err %d\n", wait_us, polls, err);
+}
+
+// wait for the i2c engine to flag the transaction done (0x18 in coef 0x5c)
+static int cs_8409_vendor_i2c_wait(struct hda_codec *codec, unsigned int *status)
+{
+	ktime_t start = ktime_get();
+	ktime_t deadline = ktime_add_us(start, i2c_wait_timeout_us);
+	unsigned int delay_us = 0;
+	unsigned int retval;
+	int polls = 0;
+	int err = 0;
+
+	for (;;) {
+		retval = cs_8409_vendor_coef_get(codec, 0x5c);
+		polls++;
+		if (retval == -1) {
+			err = -EIO;
+			break;
+		}
+		if ((retval & 0x18) == 0x18)
+			break;
+		if (ktime_after(ktime_get(), deadline)) {
+			err = -ETIMEDOUT;
+			break;
+		}
+		if (polls <= i2c_wait_spin)
+			continue;
+		if (delay_us == 0)
+			delay_us = max(i2c_wait_min_us, 1U);
+		else
+			delay_us = min(delay_us * 2, max(i2c_wait_max_us, delay_us));
+		usleep_range(delay_us, delay_us * 2);
+	}
+
+	cs_8409_vendor_i2c_wait_account(codec, ktime_us_delta(ktime_get(), start), polls, err);
+
+	if (err == -ETIMEDOUT)
+		codec_err(codec, "i2c transaction timed out status 0x%04x\n", retval);
+
+	if (status)
+		*status = retval;
+
+	return err;
+}
+
+// debugfs - cs8409-<codec device>/ in the debugfs root
+
+static int cs_8409_i2c_wait_stats_show(struct seq_file *m, void *v)
+{
+	struct hda_codec *codec = m->private;
+	struct cs_spec *spec = codec->spec;
+	int i;
+
+	mutex_lock(&spec->i2c_mutex);
+	seq_printf(m, "transactions: %u\n", spec->i2c_wait_count);
+	seq_printf(m, "timeouts: %u\n", spec->i2c_wait_timeouts);
+	seq_printf(m, "total us: %llu\n", spec->i2c_wait_total_us);
+	seq_printf(m, "peak us: %u\n", spec->i2c_wait_peak_us);
+	for (i = 0; i < ARRAY_SIZE(spec->i2c_wait_hist); i++) {
+		if (i < ARRAY_SIZE(spec->i2c_wait_hist) - 1)
+			seq_printf(m, "< %5u us: %u\n", 16U << i, spec->i2c_wait_hist[i]);
+		else
+			seq_printf(m, ">=%5u us: %u\n", 16U << (i - 1), spec->i2c_wait_hist[i]);
+	}
+	mutex_unlock(&spec->i2c_mutex);
+
+	return 0;
+}
+
+static int cs_8409_i2c_wait_stats_open(struct inode *inode, struct file *file)
+{
+	return single_open(file, cs_8409_i2c_wait_stats_show, inode->i_private);
+}
+
+static const struct file_operations cs_8409_i2c_wait_stats_fops = {
+	.owner = THIS_MODULE,
+	.open = cs_8409_i2c_wait_stats_open,
+	.read = seq_read,
+	.llseek = seq_lseek,
+	.release = single_release,
+};
+
+// the i2c clock (coef 0 bit 3) is reference counted
+// the first user of a window turns it on and it is only turned off once the
+// last user has gone and the bus has then been idle for i2c_clock_idle_ms
+// so a burst of amp programming toggles it once
+// users/state are protected by i2c_mutex
+static unsigned int i2c_clock_idle_ms = 50;
+module_param(i2c_clock_idle_ms, uint, 0644);
+MODULE_PARM_DESC(i2c_clock_idle_ms, "CS8409 i2c clock idle time before disabling (ms, 0 = immediately)");
+
+static void cs_8409_vendor_i2c_clock_get(struct hda_codec *codec)
+{
+	struct cs_spec *spec = codec->spec;
+
+	// the work waits on i2c_mutex and rechecks users so no need to sync
+	cancel_delayed_work(&spec->i2c_clk_work);
+
+	if (spec->i2c_clk_users++ == 0 && !spec->i2c_clk_on)
+		cs_8409_vendor_enableI2Cclock(codec, 0x1);
+}
+
+static void cs_8409_vendor_i2c_clock_put(struct hda_codec *codec)
+{
+	struct cs_spec *spec = codec->spec;
+
+	if (WARN_ON(spec->i2c_clk_users == 0))
+		return;
+
+	if (--spec->i2c_clk_users)
+		return;
+
+	if (!i2c_clock_idle_ms) {
+		if (spec->i2c_clk_on)
+			cs_8409_vendor_enableI2Cclock(codec, 0x0);
+		return;
+	}
+
+	schedule_delayed_work(&spec->i2c_clk_work, msecs_to_jiffies(i2c_clock_idle_ms));
+}
+
+static void cs_8409_vendor_i2c_clock_work(struct work_struct *work)
+{
+	struct cs_spec *spec = container_of(work, struct cs_spec, i2c_clk_work.work);
+	struct hda_codec *codec = spec->codec;
+
+	mutex_lock(&spec->i2c_mutex);
+	if (!spec->i2c_clk_users && spec->i2c_clk_on) {
+		snd_hda_power_up_pm(codec);
+		cs_8409_vendor_enableI2Cclock(codec, 0x0);
+		snd_hda_power_down_pm(codec);
+	}
+	mutex_unlock(&spec->i2c_mutex);
+}
+
+// drop an idle clock now - for suspend and free
+static void cs_8409_vendor_i2c_clock_flush(struct hda_codec *codec, int powered)
+{
+	struct cs_spec *spec = codec->spec;
+
+	cancel_delayed_work_sync(&spec->i2c_clk_work);
+
+	mutex_lock(&spec->i2c_mutex);
+	if (!spec->i2c_clk_users && spec->i2c_clk_on) {
+		if (powered)
+			cs_8409_vendor_enableI2Cclock(codec, 0x0);
+		spec->i2c_clk_on = 0;
+	}
+	mutex_unlock(&spec->i2c_mutex);
+}
+
+// power up, processing on and enable the i2c clock
+static void cs_8409_vendor_i2c_start(struct hda_codec *codec)
+{
+	hda_set_node_power_state(codec, codec->core.afg, AC_PWRST_D0);
+	// exit on error
+
+	snd_hda_codec_write(codec, CS8409_VENDOR_NID, 0, AC_VERB_SET_PROC_STATE, 0x00000001);
+	// exit on error
+
+	cs_8409_vendor_i2c_clock_get(codec);
+}
+
+static void cs_8409_vendor_i2c_stop(struct hda_codec *codec)
+{
+	cs_8409_vendor_i2c_clock_put(codec);
+	// exit on error
+
+	//hda_set_node_power_state(codec, codec->core.afg, AC_PWRST_D3);
+	// exit on error
+}
+
+static void cs_8409_vendor_i2c_address(struct hda_codec *codec, unsigned int i2c_address)
+{
+	struct cs_spec *spec = codec->spec;
+
+	cs_8409_vendor_coef_set(codec, 0x59, i2c_address);
+	spec->i2c_address = i2c_address;
+}
+
+// the page select of a paged access is a write of the page to register 0x00
+// so remember the last value written there per device and skip the page
+// write (and its completion wait) when the page has not changed
+static void cs_8409_vendor_i2c_page_track(struct hda_codec *codec, unsigned int i2c_reg, unsigned int page)
+{
+	struct cs_spec *spec = codec->spec;
+	unsigned int idx = (spec->i2c_address >> 1) & 0x7f;
+
+	if ((i2c_reg & 0xff) != 0x00)
+		return;
+
+	spec->i2c_page[idx] = page;
+	set_bit(idx, spec->i2c_page_valid);
+}
+
+static void cs_8409_vendor_i2c_page_invalidate(struct hda_codec *codec)
+{
+	struct cs_spec *spec = codec->spec;
+
+	bitmap_zero(spec->i2c_page_valid, 128);
+}
+
+static int cs_8409_vendor_i2c_page(struct hda_codec *codec, unsigned int i2c_reg)
+{
+	struct cs_spec *spec = codec->spec;
+	unsigned int idx = (spec->i2c_address >> 1) & 0x7f;
+	unsigned int page = (i2c_reg >> 8) & 0xff;
+	int err;
+
+	if (test_bit(idx, spec->i2c_page_valid) && spec->i2c_page[idx] == page)
+		return 0;
+
+	cs_8409_vendor_coef_set(codec, 0x5d, page);
+	err = cs_8409_vendor_i2c_wait(codec, NULL);
+	if (err < 0) {
+		clear_bit(idx, spec->i2c_page_valid);
+		return err;
+	}
+
+	cs_8409_vendor_i2c_page_track(codec, 0x00, page);
+
+	return 0;
+}
+
+// read one register from the device latched in coef 0x59
+static int cs_8409_vendor_i2c_xfer_read(struct hda_codec *codec, unsigned int i2c_reg,
+                                        unsigned int paged, unsigned int *i2c_val)
+{
+	unsigned int i2c_reg_data;
+	int err;
+
+	if (paged) {
+		err = cs_8409_vendor_i2c_page(codec, i2c_reg);
+		if (err < 0)
+			return err;
+	}
+
+	// so the i2c register is stored in the low byte of i2c_reg
+	// shift it 8 bits to left for sending as coefficient data (16 bits)
+	// hmm - why do I need a mask??
+	// think either we mask here or in cs_8409_vendor_coef_set
+	// Apple is using short ints so likely automasked
+	i2c_reg_data = (i2c_reg << 8) & 0x0ffff;
+
+	cs_8409_vendor_coef_set(codec, 0x5e, i2c_reg_data);
+
+	err = cs_8409_vendor_i2c_wait(codec, NULL);
+	if (err < 0)
+		return err;
+
+	// well thats interesting - looks as though the 16 bit return
+	// has the register in bits 15-8 and the data in 7-0
+	// probably should mask the data out
+	*i2c_val = cs_8409_vendor_coef_get(codec, 0x5e);
+	if (*i2c_val == -1)
+		return -EIO;
+
+	return 0;
+}
+
+// write one register to the device latched in coef 0x59
+static int cs_8409_vendor_i2c_xfer_write(struct hda_codec *codec, unsigned int i2c_reg,
+                                         unsigned int i2c_data, unsigned int paged)
+{
+	struct cs_spec *spec = codec->spec;
+	unsigned int i2c_reg_data;
+	int err;
+
+	if (paged) {
+		err = cs_8409_vendor_i2c_page(codec, i2c_reg);
+		if (err < 0)
+			return err;
+	}
+
+	// so the i2c register is stored in the low byte of i2c_reg
+	// shift it 8 bits to left for sending as coefficient data (16 bits)
+	// then or in the 8 byte data
+	// mask here or in cs_8409_vendor_coef_set?
+	i2c_reg_data = ((i2c_reg << 8) & 0x0ff00) | ( i2c_data & 0x0ff);
+
+	cs_8409_vendor_coef_set(codec, 0x5d, i2c_reg_data);
+
+	err = cs_8409_vendor_i2c_wait(codec, NULL);
+
+	// a failed write leaves register 0x00 unknown
+	if (err < 0 && (i2c_reg & 0xff) == 0x00)
+		clear_bit((spec->i2c_address >> 1) & 0x7f, spec->i2c_page_valid);
+	else if (!err)
+		cs_8409_vendor_i2c_page_track(codec, i2c_reg, i2c_data & 0xff);
+
+	return err;
+}
+
+static unsigned int cs_8409_vendor_i2cRead(struct hda_codec *codec, unsigned int i2c_address,
+                                            unsigned int i2c_reg, unsigned int paged)
+{
+	// AppleHDAFunctionGroupCS8409::_i2cRead(bool, unsigned short, unsigned short, unsigned int*)
+	// note that last argument is return data
+	unsigned int retval;
+
+	struct cs_spec *spec = codec->spec;
+
+        printk("snd_hda_intel: i2cRead 0x%04x 0x%04x: %d",i2c_address,i2c_reg,paged);
+
+	mutex_lock(&spec->i2c_mutex);
+
+	cs_8409_vendor_i2c_start(codec);
+
+	cs_8409_vendor_i2c_address(codec, i2c_address);
+
+	if (cs_8409_vendor_i2c_xfer_read(codec, i2c_reg, paged, &retval) < 0)
+		retval = -1;
+
+	cs_8409_vendor_i2c_stop(codec);
+
+	mutex_unlock(&spec->i2c_mutex);
+
+        printk("snd_hda_intel: i2cRead 0x%04x 0x%04x:  0x%04x end",i2c_address,i2c_reg,retval);
+
+	return retval;
+
+}
+
+static unsigned int cs_8409_vendor_i2cWrite(struct hda_codec *codec, unsigned int i2c_address,
+                                      unsigned int i2c_reg, unsigned int i2c_data, unsigned int paged)
+{
+	// AppleHDAFunctionGroupCS8409::_i2cWrite(bool, unsigned short, unsigned short, unsigned short)
+	unsigned int retval;
+
+	struct cs_spec *spec = codec->spec;
+
+        printk("snd_hda_intel: i2cWrite 0x%04x 0x%04x: 0x%04x %d",i2c_address,i2c_reg,i2c_data,paged);
+
+	mutex_lock(&spec->i2c_mutex);
+
+	cs_8409_vendor_i2c_start(codec);
+
+	cs_8409_vendor_i2c_address(codec, i2c_address);
+
+	// 0 on success -1 on error or timeout
+	if (cs_8409_vendor_i2c_xfer_write(codec, i2c_reg, i2c_data, paged) < 0)
+		retval = -1;
+	else
+		retval = 0;
+
+	cs_8409_vendor_i2c_stop(codec);
+
+	mutex_unlock(&spec->i2c_mutex);
+
+        printk("snd_hda_intel: i2cWrite 0x%04x 0x%04x: 0x%04x %d end",i2c_address,i2c_reg,i2c_data,paged);
+
+	return retval;
+}
+
+
+// batched i2c transactions
+// a batch runs under one power check/proc state/clock enable and only
+// re-latches the device address when it changes between ops
+// reads return their data in the data field of the op
+
+struct cs8409_i2c_op {
+        u16 address;
+        u16 reg;
+        u16 data;
+        u8 write;
+        u8 paged;
+};
+
+static int cs_8409_vendor_i2c_batch(struct hda_codec *codec, struct cs8409_i2c_op *ops, int nops)
+{
+	struct cs_spec *spec = codec->spec;
+	unsigned int latched = 0;
+	unsigned int val = 0;
+	int ret = 0;
+	int err;
+	int i;
+
+	if (nops <= 0)
+		return 0;
+
+        printk("snd_hda_intel: i2c batch %d ops start",nops);
+
+	mutex_lock(&spec->i2c_mutex);
+
+	cs_8409_vendor_i2c_start(codec);
+
+	for (i = 0; i < nops; i++) {
+		struct cs8409_i2c_op *op = &ops[i];
+
+		// 0 is not a valid amp address so always latch the first op
+		if (op->address != latched) {
+			cs_8409_vendor_i2c_address(codec, op->address);
+			latched = op->address;
+		}
+
+		if (op->write)
+			err = cs_8409_vendor_i2c_xfer_write(codec, op->reg, op->data, op->paged);
+		else {
+			err = cs_8409_vendor_i2c_xfer_read(codec, op->reg, op->paged, &val);
+			op->data = val;
+		}
+
+		codec_dbg(codec, "i2c batch %s 0x%02x 0x%04x: 0x%04x %d err %d\n", op->write ? "wr" : "rd",
+			  op->address, op->reg, op->data, op->paged, err);
+
+		// carry on with the rest of the batch - as the single transfers do
+		if (err < 0 && !ret)
+			ret = err;
+	}
+
+	cs_8409_vendor_i2c_stop(codec);
+
+	mutex_unlock(&spec->i2c_mutex);
+
+        printk("snd_hda_intel: i2c batch %d ops end",nops);
+
+	return ret;
+}
+
+
+static void cs_8409_amp_invalidate(struct hda_codec *codec, unsigned int amp_address);
+static struct cs8409_amp *cs_8409_amp_get(struct hda_codec *codec, unsigned int amp_address);
+
+// expose the coef i2c engine as a linux i2c adapter
+// so i2c-dev/i2cdetect and the i2c tracepoints can get at the amps
+// the engine only does single register transfers with an 8 bit register
+// number so messages are mapped as
+//   write [reg, data...]         - one register write per data byte (reg, reg+1, ...)
+//   write [reg] then read [n]    - one register read per byte (reg, reg+1, ...)
+// which covers the smbus byte data and i2c block transfers the core emulates
+// a whole transfer runs in one clock enable window
+// note the engine takes 8 bit (shifted) addresses eg MAX98706 0x32 is 0x64
+// the paged SSM3515s (14,1) are accessed with page 0 selected as the amp maps do
+
+#if IS_ENABLED(CONFIG_I2C)
+
+static int cs_8409_i2c_master_xfer(struct i2c_adapter *adap, struct i2c_msg *msgs, int num)
+{
+	struct hda_codec *codec = i2c_get_adapdata(adap);
+	struct cs_spec *spec = codec->spec;
+	unsigned int latched = 0;
+	unsigned int retval;
+	int err = 0;
+	int i, j;
+
+	// check everything first so we dont leave a transfer half done
+	for (i = 0; i < num; i++) {
+		if (msgs[i].flags & ~I2C_M_RD)
+			return -EOPNOTSUPP;
+		if (msgs[i].flags & I2C_M_RD) {
+			// a read needs the register from the previous write
+			if (i == 0 || (msgs[i-1].flags & I2C_M_RD) || msgs[i-1].len != 1 ||
+			    msgs[i-1].addr != msgs[i].addr)
+				return -EOPNOTSUPP;
+		}
+		else if (msgs[i].len == 0)
+			return -EOPNOTSUPP;
+	}
+
+	// i2c-dev can get here with the codec runtime suspended
+	snd_hda_power_up(codec);
+
+	mutex_lock(&spec->i2c_mutex);
+
+	cs_8409_vendor_i2c_start(codec);
+
+	for (i = 0; i < num && !err; i++) {
+		struct i2c_msg *msg = &msgs[i];
+		unsigned int i2c_address = (msg->addr << 1) & 0xfe;
+		struct cs8409_amp *amp = cs_8409_amp_get(codec, i2c_address);
+		// the SSM3515s need the page 0 select before each register access
+		unsigned int paged = amp ? amp->paged : 0;
+
+		if (i2c_address != latched) {
+			cs_8409_vendor_i2c_address(codec, i2c_address);
+			latched = i2c_address;
+		}
+
+		if (msg->flags & I2C_M_RD) {
+			unsigned int reg = msgs[i-1].buf[0];
+
+			for (j = 0; j < msg->len; j++) {
+				err = cs_8409_vendor_i2c_xfer_read(codec, reg + j, paged, &retval);
+				if (err < 0)
+					break;
+				msg->buf[j] = retval & 0xff;
+			}
+		}
+		else {
+			unsigned int reg = msg->buf[0];
+
+			// a register only write is the first half of a read
+			for (j = 1; j < msg->len; j++) {
+				err = cs_8409_vendor_i2c_xfer_write(codec, reg + j - 1, msg->buf[j], paged);
+				if (err < 0)
+					break;
+			}
+
+			// the page selection of a paged amp is unknown after a raw write
+			if (msg->len > 1)
+				clear_bit(msg->addr & 0x7f, spec->i2c_page_valid);
+		}
+	}
+
+	cs_8409_vendor_i2c_stop(codec);
+
+	mutex_unlock(&spec->i2c_mutex);
+
+	// outside i2c_mutex - the regmap lock is taken before it elsewhere
+	for (i = 0; i < num; i++)
+		if (!(msgs[i].flags & I2C_M_RD) && msgs[i].len > 1)
+			cs_8409_amp_invalidate(codec, (msgs[i].addr << 1) & 0xfe);
+
+	snd_hda_power_down(codec);
+
+	return err ? err : num;
+}
+
+static u32 cs_8409_i2c_functionality(struct i2c_adapter *adap)
+{
+	return I2C_FUNC_SMBUS_BYTE_DATA | I2C_FUNC_SMBUS_I2C_BLOCK;
+}
+
+static const struct i2c_algorithm cs_8409_i2c_algo = {
+	.master_xfer = cs_8409_i2c_master_xfer,
+	.functionality = cs_8409_i2c_functionality,
+};
+
+static int cs_8409_i2c_adapter_init(struct hda_codec *codec)
+{
+	struct cs_spec *spec = codec->spec;
+	struct i2c_adapter *adap = &spec->i2c_adap;
+	int err;
+
+	adap->owner = THIS_MODULE;
+	adap->algo = &cs_8409_i2c_algo;
+	adap->dev.parent = hda_codec_dev(codec);
+	snprintf(adap->name, sizeof(adap->name), "CS8409 HDA i2c %s", dev_name(hda_codec_dev(codec)));
+	i2c_set_adapdata(adap, codec);
+
+	err = i2c_add_adapter(adap);
+	if (err < 0) {
+		// the amps are still driven internally so carry on without the adapter
+		codec_err(codec, "i2c adapter add failed %d\n", err);
+		return 0;
+	}
+	spec->i2c_adap_added = 1;
+
+	return 0;
+}
+
+static void cs_8409_i2c_adapter_free(struct hda_codec *codec)
+{
+	struct cs_spec *spec = codec->spec;
+
+	if (spec->i2c_adap_added)
+		i2c_del_adapter(&spec->i2c_adap);
+	spec->i2c_adap_added = 0;
+}
+
+#else
+
+static int cs_8409_i2c_adapter_init(struct hda_codec *codec)
+{
+	return 0;
+}
+
+static void cs_8409_i2c_adapter_free(struct hda_codec *codec)
+{
+}
+
+#endif
+
+
+// regmap backend for the speaker amps
+// each amp gets its own regmap over the coef i2c engine so the amp
+// register writes go through the regmap cache - a write of the value
+// already in the cache is skipped and status/interrupt registers are
+// always sent to the hardware
+// the maps show up in debugfs under regmap/ as amp-XX
+
+static int cs_8409_amp_regmap_read(void *context, unsigned int reg, unsigned int *val)
+{
+	struct cs8409_amp *amp = context;
+	unsigned int retval;
+
+	retval = cs_8409_vendor_i2cRead(amp->codec, amp->address, reg, amp->paged);
+	if (retval == -1)
+		return -EIO;
+
+	// the register number comes back in bits 15-8
+	*val = retval & 0xff;
+
+	return 0;
+}
+
+static int cs_8409_amp_regmap_write(void *context, unsigned int reg, unsigned int val)
+{
+	struct cs8409_amp *amp = context;
+	unsigned int retval;
+
+	retval = cs_8409_vendor_i2cWrite(amp->codec, amp->address, reg, val, amp->paged);
+	if (retval == -1)
+		return -EIO;
+
+	return 0;
+}
+
+static const struct regmap_bus cs_8409_amp_regmap_bus = {
+	.reg_read = cs_8409_amp_regmap_read,
+	.reg_write = cs_8409_amp_regmap_write,
+};
+
+// MAX98706 status, interrupt clear and reset registers
+static bool cs_8409_max98706_volatile_reg(struct device *dev, unsigned int reg)
+{
+	switch (reg) {
+	case 0x03: // InterruptState0
+	case 0x04: // InterruptState1
+	case 0x09: // InterruptClears0
+	case 0x0a: // InterruptClears1
+	case 0x0c: // State1
+	case 0x0f: // IRQClear1
+	case 0x51: // SoftwareReset
+		return true;
+	}
+	return false;
+}
+
+// SSM3515 - only the setup registers 0x01-0x05 are cached
+// the rest (battery/limiter/status) are read from the amp and 0x00
+// (PowerControl) is also where the page select of every paged access goes
+// behind the map so it is never cached either
+static bool cs_8409_ssm3515_volatile_reg(struct device *dev, unsigned int reg)
+{
+	return reg == 0x00 || reg > 0x05;
+}
+
+static const struct regmap_config cs_8409_max98706_regmap_config = {
+	.reg_bits = 8,
+	.val_bits = 8,
+	.max_register = 0xff,
+	.volatile_reg = cs_8409_max98706_volatile_reg,
+	.cache_type = REGCACHE_RBTREE,
+};
+
+static const struct regmap_config cs_8409_ssm3515_regmap_config = {
+	.reg_bits = 8,
+	.val_bits = 8,
+	.max_register = 0xff,
+	.volatile_reg = cs_8409_ssm3515_volatile_reg,
+	.cache_type = REGCACHE_RBTREE,
+};
+
+static const unsigned int cs_8409_max98706_addresses[] = { 0x64, 0x62, 0x74, 0x72 };
+static const unsigned int cs_8409_ssm3515_addresses[] = { 0x28, 0x2a, 0x2c, 0x2e };
+
+static struct cs8409_amp *cs_8409_amp_get(struct hda_codec *codec, unsigned int amp_address)
+{
+	struct cs_spec *spec = codec->spec;
+	int i;
+
+	for (i = 0; i < spec->num_amps; i++)
+		if (spec->amps[i].address == amp_address)
+			return &spec->amps[i];
+
+	return NULL;
+}
+
+static void cs_8409_amps_free(struct hda_codec *codec)
+{
+	struct cs_spec *spec = codec->spec;
+	int i;
+
+	for (i = 0; i < spec->num_amps; i++) {
+		if (spec->amps[i].regmap)
+			regmap_exit(spec->amps[i].regmap);
+		spec->amps[i].regmap = NULL;
+	}
+	spec->num_amps = 0;
+}
+
+static int cs_8409_amps_init(struct hda_codec *codec)
+{
+	struct cs_spec *spec = codec->spec;
+	struct regmap_config config;
+	const unsigned int *addresses;
+	unsigned int paged;
+	int i;
+
+	if (codec->core.subsystem_id == 0x106b3900) {
+		config = cs_8409_max98706_regmap_config;
+		addresses = cs_8409_max98706_addresses;
+		paged = 0;
+	}
+	else if (codec->core.subsystem_id == 0x106b3300) {
+		config = cs_8409_ssm3515_regmap_config;
+		addresses = cs_8409_ssm3515_addresses;
+		paged = 1;
+	}
+	else {
+		// unknown machine - no amps to map, boot setup reports this
+		return 0;
+	}
+
+	for (i = 0; i < ARRAY_SIZE(spec->amps); i++) {
+		struct cs8409_amp *amp = &spec->amps[i];
+
+		amp->codec = codec;
+		amp->address = addresses[i];
+		amp->paged = paged;
+		amp->primed = 0;
+		snprintf(amp->name, sizeof(amp->name), "amp-%02x", amp->address);
+
+		config.name = amp->name;
+		amp->regmap = regmap_init(hda_codec_dev(codec), &cs_8409_amp_regmap_bus, amp, &config);
+		if (IS_ERR(amp->regmap)) {
+			int err = PTR_ERR(amp->regmap);
+			codec_err(codec, "amp 0x%02x regmap init failed %d\n", amp->address, err);
+			amp->regmap = NULL;
+			cs_8409_amps_free(codec);
+			return err;
+		}
+		spec->num_amps = i + 1;
+	}
+
+	return 0;
+}
+
+// the amps have been reset behind the cache - any cached values have to be
+// written again on the next register list run and the page selection is lost
+static void cs_8409_amps_mark_dirty(struct hda_codec *codec)
+{
+	struct cs_spec *spec = codec->spec;
+	int i;
+
+	mutex_lock(&spec->i2c_mutex);
+	cs_8409_vendor_i2c_page_invalidate(codec);
+	mutex_unlock(&spec->i2c_mutex);
+
+	for (i = 0; i < spec->num_amps; i++) {
+		regcache_mark_dirty(spec->amps[i].regmap);
+		spec->amps[i].dirty = 1;
+	}
+}
+
+// an amp has been written behind its regmap (i2c adapter) - drop the cached
+// values so reads go to the amp and have the next setup list write every
+// register again rather than only the ones differing from the cache
+static void cs_8409_amp_invalidate(struct hda_codec *codec, unsigned int amp_address)
+{
+	struct cs8409_amp *amp = cs_8409_amp_get(codec, amp_address);
+
+	if (!amp || !amp->regmap)
+		return;
 
-static inline unsigned int cs_8409_vendor_coef_get(struct hda_codec *codec, unsigned int idx)
-{
-        struct cs_spec *spec = codec->spec;
-        unsigned int retval;
-        snd_hda_codec_read(codec, spec->vendor_nid, 0,
-                            AC_VERB_GET_COEF_INDEX, 0);
-        snd_hda_codec_write(codec, spec->vendor_nid, 0,
-                            AC_VERB_SET_COEF_INDEX, idx);
-        retval = snd_hda_codec_read(codec, spec->vendor_nid, 0,
-                                  AC_VERB_GET_PROC_COEF, 0);
-        snd_hda_codec_write(codec, spec->vendor_nid, 0,
-                            AC_VERB_SET_COEF_INDEX, 0);
-        return retval;
+	regcache_drop_region(amp->regmap, 0, 0xff);
+	regcache_mark_dirty(amp->regmap);
+	amp->dirty = 1;
+	amp->primed = 0;
 }
 
-static inline void cs_8409_vendor_coef_set(struct hda_codec *codec, unsigned int idx,
-                                      unsigned int coef)
+// single register read through the amp regmap
+// falls back to a direct i2c transfer for an address without a map
+static unsigned int cs_8409_amp_regmap_read_reg(struct hda_codec *codec, unsigned int amp_address,
+                                                unsigned int reg)
 {
-        struct cs_spec *spec = codec->spec;
-        snd_hda_codec_read(codec, spec->vendor_nid, 0,
-                            AC_VERB_GET_COEF_INDEX, 0);
-        snd_hda_codec_write(codec, spec->vendor_nid, 0,
-                            AC_VERB_SET_COEF_INDEX, idx);
-        snd_hda_codec_write(codec, spec->vendor_nid, 0,
-                            AC_VERB_SET_PROC_COEF, coef);
-        snd_hda_codec_write(codec, spec->vendor_nid, 0,
-                            AC_VERB_SET_COEF_INDEX, 0);
-        // appears to return 0
+	struct cs8409_amp *amp = cs_8409_amp_get(codec, amp_address);
+	unsigned int val;
+
+	if (!amp || !amp->regmap)
+		return cs_8409_vendor_i2cRead(codec, amp_address, reg, 0);
+
+	if (regmap_read(amp->regmap, reg, &val) < 0)
+		return -1;
+
+	// keep the i2cRead format - register in bits 15-8
+	return ((reg << 8) & 0xff00) | (val & 0xff);
 }
 
-static inline unsigned int cs_8409_vendor_coef_set_mask(struct hda_codec *codec, unsigned int idx,
-                                      unsigned int coef, unsigned int mask)
+// status/interrupt clear/reset registers - always written to the amp
+static bool cs_8409_amp_reg_volatile(struct cs8409_amp *amp, unsigned int reg)
 {
-        struct cs_spec *spec = codec->spec;
-        unsigned int retval;
-        //unsigned int mask_coef;
-        snd_hda_codec_read(codec, spec->vendor_nid, 0,
-                            AC_VERB_GET_COEF_INDEX, 0);
-        snd_hda_codec_write(codec, spec->vendor_nid, 0,
-                            AC_VERB_SET_COEF_INDEX, idx);
-        retval = snd_hda_codec_read(codec, spec->vendor_nid, 0,
-                                  AC_VERB_GET_PROC_COEF, 0);
-        snd_hda_codec_write(codec, spec->vendor_nid, 0,
-                            AC_VERB_SET_COEF_INDEX, idx);
-	//mask_coef = (retval & ~mask) | coef;
-        snd_hda_codec_write(codec, spec->vendor_nid, 0,
-                            AC_VERB_SET_PROC_COEF, coef);
-        snd_hda_codec_write(codec, spec->vendor_nid, 0,
-                            AC_VERB_SET_COEF_INDEX, 0);
-        // appears to return 0
-        // lets return the read value for checking
-        return retval;
+	if (amp->paged)
+		return cs_8409_ssm3515_volatile_reg(NULL, reg);
+	return cs_8409_max98706_volatile_reg(NULL, reg);
 }
 
-static inline void cs_8409_vendor_enableI2Cclock(struct hda_codec *codec, unsigned int flag)
+// after a reset restore the cached registers that are not in the setup
+// list about to be run - the list itself is written in its own (Apple) order
+// rather than by regcache_sync in register order
+// only done for the setup (prime) list - a single register list such as the
+// amp enable is just written and the restore left to the next setup
+static void cs_8409_amp_regmap_restore(struct cs8409_amp *amp, const struct cs8409_i2c_op *ops, int nops)
 {
+	DECLARE_BITMAP(in_ops, 256);
+	unsigned int reg, end;
+	int err;
+	int i;
+
+	if (!amp->dirty)
+		return;
 
-	unsigned int retval = 0;
-	unsigned int newval = 0;
+	bitmap_zero(in_ops, 256);
+	for (i = 0; i < nops; i++)
+		if (ops[i].write)
+			set_bit(ops[i].reg & 0xff, in_ops);
+
+	for (reg = 0; reg < 256; reg = end + 1) {
+		reg = find_next_zero_bit(in_ops, 256, reg);
+		if (reg >= 256)
+			break;
+		end = find_next_bit(in_ops, 256, reg) - 1;
+		err = regcache_sync_region(amp->regmap, reg, end);
+		if (err < 0)
+			codec_dbg(amp->codec, "amp 0x%02x regcache sync 0x%02x-0x%02x failed %d\n",
+				  amp->address, reg, end, err);
+	}
+}
 
-	// note that apple returns the status value with data value in returned parameter 
-	// snd_hda_codec_read just returns value - not sure what happens about errors
-	// looks as tho its assumed -1 is not a valid return value
-	// ah yes - because max val is 16 bit quantity
+// run an amp register list through the amp regmap
+// the first time the setup list (prime set) is run every register is written
+// to prime the cache - after that only cached registers whose value differs
+// from the cache cost an i2c transfer (volatile ones are always written)
+// after a reset the whole list is written in order and for the setup list
+// the other cached registers restored first - see cs_8409_amp_regmap_restore
+static int cs_8409_amp_regmap_sequence(struct hda_codec *codec, unsigned int amp_address,
+                                       struct cs8409_i2c_op *ops, int nops, int prime)
+{
+	struct cs8409_amp *amp = cs_8409_amp_get(codec, amp_address);
+	unsigned int val;
+	int full;
+	int err = 0;
+	int i;
 
-	retval = cs_8409_vendor_coef_get(codec, 0x0);
-	//if (retval == -1)
+	if (!amp || !amp->regmap)
+		return cs_8409_vendor_i2c_batch(codec, ops, nops);
 
-	if (retval == -1)
-		return;
+	full = !amp->primed || amp->dirty;
+	if (prime)
+		cs_8409_amp_regmap_restore(amp, ops, nops);
 
-	newval = retval;
-	if (flag)
-		newval |= 0x8;
-	else
-		newval = (retval & 0xfffffff7);
+	for (i = 0; i < nops; i++) {
+		struct cs8409_i2c_op *op = &ops[i];
 
-	cs_8409_vendor_coef_set(codec, 0x0, newval);
+		if (!op->write) {
+			err = regmap_read(amp->regmap, op->reg, &val);
+			if (!err)
+				op->data = val;
+		}
+		else if (full || cs_8409_amp_reg_volatile(amp, op->reg))
+			err = regmap_write(amp->regmap, op->reg, op->data);
+		else
+			err = regmap_update_bits(amp->regmap, op->reg, 0xff, op->data);
+
+		if (err < 0) {
+			codec_dbg(codec, "amp 0x%02x regmap reg 0x%02x failed %d\n", amp->address, op->reg, err);
+			return err;
+		}
+	}
+
+	if (prime) {
+		amp->dirty = 0;
+		amp->primed = 1;
+	}
 
+	return 0;
 }
 
 
-// define i2cRead and i2cWrite functions
-// following Apple
-static unsigned int cs_8409_vendor_i2cRead(struct hda_codec *codec, unsigned int i2c_address,
-                                            unsigned int i2c_reg, unsigned int paged)
+// broadcast - the same register list to several amps
+// runs in one i2c window, latching each address once and running the whole
+// list on it - the list addresses are ignored and read data is dropped
+// status[i] gets 0 or the first error for addresses[i]
+static int cs_8409_vendor_i2c_broadcast(struct hda_codec *codec, const unsigned int *addresses, int naddr,
+                                        const struct cs8409_i2c_op *ops, int nops, int *status)
 {
-	// AppleHDAFunctionGroupCS8409::_i2cRead(bool, unsigned short, unsigned short, unsigned int*)
-	// note that last argument is return data
-	unsigned int i2c_reg_data;
-	unsigned int retval;
-	int rdcnt;
-
-        printk("snd_hda_intel: i2cRead 0x%04x 0x%04x: %d",i2c_address,i2c_reg,paged);
+	struct cs_spec *spec = codec->spec;
+	unsigned int val;
+	int ret = 0;
+	int err;
+	int i, j;
 
-	hda_set_node_power_state(codec, codec->core.afg, AC_PWRST_D0);
-	// exit on error
+	if (naddr <= 0 || nops <= 0)
+		return 0;
 
-	snd_hda_codec_write(codec, CS8409_VENDOR_NID, 0, AC_VERB_SET_PROC_STATE, 0x00000001);
-	// exit on error
+        printk("snd_hda_intel: i2c broadcast %d amps %d ops start",naddr,nops);
 
-	cs_8409_vendor_enableI2Cclock(codec, 0x1);
+	mutex_lock(&spec->i2c_mutex);
 
+	cs_8409_vendor_i2c_start(codec);
 
-	cs_8409_vendor_coef_set(codec, 0x59, i2c_address);
+	for (i = 0; i < naddr; i++) {
+		status[i] = 0;
 
-	if (paged)
-	{
-		unsigned int retval1;
+		cs_8409_vendor_i2c_address(codec, addresses[i]);
 
-		cs_8409_vendor_coef_set(codec, 0x5d, i2c_reg >> 8);
-sleep1:
-		rdcnt = -8;
+		for (j = 0; j < nops; j++) {
+			const struct cs8409_i2c_op *op = &ops[j];
 
-		retval1 = cs_8409_vendor_coef_get(codec, 0x5c);
+			if (op->write)
+				err = cs_8409_vendor_i2c_xfer_write(codec, op->reg, op->data, op->paged);
+			else
+				err = cs_8409_vendor_i2c_xfer_read(codec, op->reg, op->paged, &val);
 
-		if (retval1 != -1)
-		{
-			retval1 &= 0x18;
-			if (retval1 != 0x18)
-			{
-				if (rdcnt < 0)
-				{
-					rdcnt++;
-					// need 0x2 according to Apple
-					usleep_range(2000,4000);
-					goto sleep1;
-				}
+			if (err < 0 && !status[i]) {
+				codec_dbg(codec, "i2c broadcast 0x%02x reg 0x%04x failed %d\n", addresses[i], op->reg, err);
+				status[i] = err;
 			}
 		}
+
+		if (status[i] && !ret)
+			ret = status[i];
 	}
 
+	cs_8409_vendor_i2c_stop(codec);
 
-	// so the i2c register is stored in the low byte of i2c_reg
-	// shift it 8 bits to left for sending as coefficient data (16 bits)
-	// hmm - why do I need a mask??
-	// think either we mask here or in cs_8409_vendor_coef_set
-	// Apple is using short ints so likely automasked
-	i2c_reg_data = (i2c_reg << 8) & 0x0ffff;
+	mutex_unlock(&spec->i2c_mutex);
 
-	cs_8409_vendor_coef_set(codec, 0x5e, i2c_reg_data);
-	//if (retval == -1)
+        printk("snd_hda_intel: i2c broadcast %d amps %d ops end",naddr,nops);
 
-	retval = cs_8409_vendor_coef_get(codec, 0x5c);
-	//if (retval == -1)
+	return ret;
+}
 
-sleep2:
-	rdcnt = -8;
+// fill the amp cache with a register list already written to the hardware
+static void cs_8409_amp_regmap_seed(struct cs8409_amp *amp, const struct cs8409_i2c_op *ops, int nops)
+{
+	int i;
+
+	// cache only - the values are already in the amp
+	regcache_cache_only(amp->regmap, true);
+	for (i = 0; i < nops; i++)
+		if (ops[i].write)
+			regmap_write(amp->regmap, ops[i].reg, ops[i].data);
+	regcache_cache_only(amp->regmap, false);
+}
 
-	retval = cs_8409_vendor_coef_get(codec, 0x5c);
-	//if (retval == -1)
+// broadcast through the amp regmaps
+// once every target amp is primed the per amp cache decides what still needs
+// writing so run the list on each map - otherwise broadcast the whole list to
+// the hardware and seed the caches with it
+// status[i] gets 0 or the first error for addresses[i]
+static int cs_8409_amp_regmap_broadcast(struct hda_codec *codec, const unsigned int *addresses, int naddr,
+                                        const struct cs8409_i2c_op *ops, int nops, int prime, int *status)
+{
+	struct cs8409_amp *amp;
+	int all_primed = 1;
+	int ret = 0;
+	int i;
+
+	for (i = 0; i < naddr; i++) {
+		amp = cs_8409_amp_get(codec, addresses[i]);
+		if (!amp || !amp->regmap || !amp->primed)
+			all_primed = 0;
+	}
 
-	if (retval != -1)
-	{
-		retval &= 0x18;
-		if (retval != 0x18)
-		{
-			if (rdcnt < 0)
-			{
-				rdcnt++;
-				// need 0x2 according to Apple
-				usleep_range(2000,4000);
-				goto sleep2;
-			}
+	if (all_primed) {
+		struct cs8409_i2c_op *amp_ops;
+
+		amp_ops = kmalloc_array(nops, sizeof(*amp_ops), GFP_KERNEL);
+		if (!amp_ops)
+			return -ENOMEM;
+
+		for (i = 0; i < naddr; i++) {
+			memcpy(amp_ops, ops, nops * sizeof(*amp_ops));
+			status[i] = cs_8409_amp_regmap_sequence(codec, addresses[i], amp_ops, nops, prime);
+			if (status[i] && !ret)
+				ret = status[i];
 		}
+
+		kfree(amp_ops);
+		return ret;
 	}
 
-	// well thats interesting - looks as though the 16 bit return
-	// has the register in bits 15-8 and the data in 7-0
-	// probably should mask the data out
-	retval = cs_8409_vendor_coef_get(codec, 0x5e);
-	//if (retval == -1)
+	for (i = 0; i < naddr; i++) {
+		amp = cs_8409_amp_get(codec, addresses[i]);
+		// restore anything cached from before a reset before overwriting
+		if (prime && amp && amp->regmap)
+			cs_8409_amp_regmap_restore(amp, ops, nops);
+	}
 
-	cs_8409_vendor_enableI2Cclock(codec, 0x0);
-	// exit on error
+	ret = cs_8409_vendor_i2c_broadcast(codec, addresses, naddr, ops, nops, status);
 
-        printk("snd_hda_intel: i2cRead 0x%04x 0x%04x:  0x%04x end",i2c_address,i2c_reg,retval);
+	for (i = 0; i < naddr; i++) {
+		amp = cs_8409_amp_get(codec, addresses[i]);
+		if (!amp || !amp->regmap || status[i])
+			continue;
+		cs_8409_amp_regmap_seed(amp, ops, nops);
+		if (prime) {
+			amp->dirty = 0;
+			amp->primed = 1;
+		}
+	}
 
-	//hda_set_node_power_state(codec, codec->core.afg, AC_PWRST_D3);
-	// exit on error
+	return ret;
+}
 
-	return retval;
 
+// asynchronous i2c queue
+// an ordered per codec workqueue of i2c op batches and plain calls (for coef
+// or verb work that has to stay in order with them) - the caller either waits
+// for the result or leaves it to run in the background with an optional
+// completion callback
+// a power reference is held while a request is pending so the codec stays up
+// the queue is drained before playback setup, suspend and free
+
+struct cs8409_i2c_req {
+	struct work_struct work;
+	struct hda_codec *codec;
+	void (*complete)(struct hda_codec *codec, struct cs8409_i2c_op *ops, int nops, int status, void *data);
+	void *data;
+	struct completion done;
+	int wait;
+	int status;
+	int nops;
+	struct cs8409_i2c_op ops[];
+};
+
+static void cs_8409_i2c_queue_work(struct work_struct *work)
+{
+	struct cs8409_i2c_req *req = container_of(work, struct cs8409_i2c_req, work);
+	struct hda_codec *codec = req->codec;
+
+	if (req->nops)
+		req->status = cs_8409_vendor_i2c_batch(codec, req->ops, req->nops);
+
+	if (req->complete)
+		req->complete(codec, req->ops, req->nops, req->status, req->data);
+
+	snd_hda_power_down_pm(codec);
+
+	if (req->wait)
+		complete(&req->done);
+	else
+		kfree(req);
 }
 
-static unsigned int cs_8409_vendor_i2cWrite(struct hda_codec *codec, unsigned int i2c_address,
-                                      unsigned int i2c_reg, unsigned int i2c_data, unsigned int paged)
+// queue a batch of i2c ops (nops may be 0 for just the callback)
+// with wait set this returns the batch status once it has run
+static int cs_8409_i2c_queue(struct hda_codec *codec, const struct cs8409_i2c_op *ops, int nops,
+                             void (*complete)(struct hda_codec *codec, struct cs8409_i2c_op *ops, int nops, int status, void *data),
+                             void *data, int wait)
 {
-	// AppleHDAFunctionGroupCS8409::_i2cWrite(bool, unsigned short, unsigned short, unsigned short)
-	unsigned int retval;
-	unsigned int i2c_reg_data;
-	int rdcnt;
+	struct cs_spec *spec = codec->spec;
+	struct cs8409_i2c_req *req;
+	int status;
 
-        printk("snd_hda_intel: i2cWrite 0x%04x 0x%04x: 0x%04x %d",i2c_address,i2c_reg,i2c_data,paged);
+	req = kzalloc(sizeof(*req) + nops * sizeof(req->ops[0]), GFP_KERNEL);
+	if (!req)
+		return -ENOMEM;
 
-	hda_set_node_power_state(codec, codec->core.afg, AC_PWRST_D0);
-	// exit on error
+	INIT_WORK(&req->work, cs_8409_i2c_queue_work);
+	init_completion(&req->done);
+	req->codec = codec;
+	req->complete = complete;
+	req->data = data;
+	req->wait = wait;
+	req->nops = nops;
+	if (nops)
+		memcpy(req->ops, ops, nops * sizeof(req->ops[0]));
 
-	snd_hda_codec_write(codec, CS8409_VENDOR_NID, 0, AC_VERB_SET_PROC_STATE, 0x00000001);
-	// exit on error
+	snd_hda_power_up_pm(codec);
 
-	cs_8409_vendor_enableI2Cclock(codec, 0x1);
+	queue_work(spec->i2c_wq, &req->work);
 
+	if (!wait)
+		return 0;
 
-	cs_8409_vendor_coef_set(codec, 0x59, i2c_address);
+	wait_for_completion(&req->done);
+	status = req->status;
+	kfree(req);
 
-	if (paged)
-	{
-		unsigned int retval1;
+	return status;
+}
+
+static void cs_8409_i2c_queue_drain(struct hda_codec *codec)
+{
+	struct cs_spec *spec = codec->spec;
 
-		cs_8409_vendor_coef_set(codec, 0x5d, i2c_reg >> 8);
+	if (spec->i2c_wq)
+		flush_workqueue(spec->i2c_wq);
+}
 
-		retval1 = cs_8409_vendor_coef_get(codec, 0x5c);
+static int cs_8409_i2c_queue_init(struct hda_codec *codec)
+{
+	struct cs_spec *spec = codec->spec;
 
-sleep1:
-		rdcnt = -8;
+	spec->i2c_wq = alloc_ordered_workqueue("cs8409-i2c", 0);
+	if (!spec->i2c_wq)
+		return -ENOMEM;
 
-		retval1 = cs_8409_vendor_coef_get(codec, 0x5c);
+	return 0;
+}
 
-		if (retval1 != -1)
-		{
-			retval1 &= 0x18;
-			if (retval1 != 0x18)
-			{
-				if (rdcnt < 0)
-				{
-					rdcnt++;
-					// need 0x2 according to Apple
-					usleep_range(2000,4000);
-					goto sleep1;
-				}
-			}
+static void cs_8409_i2c_queue_free(struct hda_codec *codec)
+{
+	struct cs_spec *spec = codec->spec;
+
+	if (spec->i2c_wq)
+		destroy_workqueue(spec->i2c_wq);
+	spec->i2c_wq = NULL;
+}
+
+
+// burst read - a set of registers from one device in one i2c window
+// the engine has no auto increment so this is one register transfer per
+// value but with a single clock enable/address latch for the whole set
+// regs NULL reads the contiguous range first_reg..first_reg+count-1
+static int cs_8409_vendor_i2c_read_regs(struct hda_codec *codec, unsigned int i2c_address,
+                                        const unsigned int *regs, unsigned int first_reg,
+                                        unsigned int *vals, int count, unsigned int paged)
+{
+	struct cs_spec *spec = codec->spec;
+	unsigned int val;
+	int ret = 0;
+	int err;
+	int i;
+
+	if (count <= 0)
+		return 0;
+
+	mutex_lock(&spec->i2c_mutex);
+
+	cs_8409_vendor_i2c_start(codec);
+
+	cs_8409_vendor_i2c_address(codec, i2c_address);
+
+	for (i = 0; i < count; i++) {
+		unsigned int reg = regs ? regs[i] : first_reg + i;
+
+		err = cs_8409_vendor_i2c_xfer_read(codec, reg, paged, &val);
+		if (err < 0) {
+			// keep going - a dump wants whatever can be read
+			vals[i] = -1;
+			if (!ret)
+				ret = err;
+			continue;
 		}
+		vals[i] = val & 0xff;
 	}
 
+	cs_8409_vendor_i2c_stop(codec);
 
-	// so the i2c register is stored in the low byte of i2c_reg
-	// shift it 8 bits to left for sending as coefficient data (16 bits)
-	// then or in the 8 byte data
-	// mask here or in cs_8409_vendor_coef_set?
-	i2c_reg_data = ((i2c_reg << 8) & 0x0ff00) | ( i2c_data & 0x0ff);
+	mutex_unlock(&spec->i2c_mutex);
 
-	cs_8409_vendor_coef_set(codec, 0x5d, i2c_reg_data);
-	//if (retval == -1)
+	return ret;
+}
+
+// debugfs amp_dump - every amp register 0x00-0xff read straight from the
+// hardware, one burst per amp
+static int cs_8409_amp_dump_show(struct seq_file *m, void *v)
+{
+	struct hda_codec *codec = m->private;
+	struct cs_spec *spec = codec->spec;
+	unsigned int *vals;
+	int i, j;
+
+	vals = kmalloc_array(0x100, sizeof(*vals), GFP_KERNEL);
+	if (!vals)
+		return -ENOMEM;
+
+	snd_hda_power_up(codec);
+
+	for (i = 0; i < spec->num_amps; i++) {
+		struct cs8409_amp *amp = &spec->amps[i];
+		int err;
+
+		err = cs_8409_vendor_i2c_read_regs(codec, amp->address, NULL, 0, vals, 0x100, amp->paged);
+		seq_printf(m, "amp 0x%02x%s\n", amp->address, err ? " (read errors)" : "");
+		for (j = 0; j < 0x100; j++) {
+			if ((j & 0xf) == 0)
+				seq_printf(m, "%02x:", j);
+			if (vals[j] == -1)
+				seq_puts(m, " XX");
+			else
+				seq_printf(m, " %02x", vals[j]);
+			if ((j & 0xf) == 0xf)
+				seq_puts(m, "\n");
+		}
+	}
 
+	snd_hda_power_down(codec);
 
-	retval = cs_8409_vendor_coef_get(codec, 0x5c);
-	//if (retval == -1)
+	kfree(vals);
 
-sleep2:
-	rdcnt = -8;
+	return 0;
+}
 
-	retval = cs_8409_vendor_coef_get(codec, 0x5c);
-	//if (retval == -1)
+static int cs_8409_amp_dump_open(struct inode *inode, struct file *file)
+{
+	return single_open(file, cs_8409_amp_dump_show, inode->i_private);
+}
 
-	if (retval != -1)
-	{
-		retval &= 0x18;
-		if (retval != 0x18)
-		{
-			if (rdcnt < 0)
-			{
-				rdcnt++;
-				// need 0x2 according to Apple
-				usleep_range(2000,4000);
-				goto sleep2;
-			}
+static const struct file_operations cs_8409_amp_dump_fops = {
+	.owner = THIS_MODULE,
+	.open = cs_8409_amp_dump_open,
+	.read = seq_read,
+	.llseek = seq_lseek,
+	.release = single_release,
+};
+
+// the replayed Apple sequences carry the logged value of every read so each
+// one can be checked against the hardware - useful while reverse engineering
+// but a full verb round trip per read for nothing on a normal boot
+//   0 off     - reads that only check a value are not done at all
+//               (the GPIO data read, which clears the interrupt status, still is)
+//   1 sampled - every seq_verify_interval'th read is checked
+//   2 full    - every read is checked
+// mismatches are counted (seq_verify_stats in debugfs) rather than logged
+// the level is per codec - seq_verify/seq_verify_interval in debugfs
+#define CS8409_SEQ_VERIFY_OFF           0
+#define CS8409_SEQ_VERIFY_SAMPLED       1
+#define CS8409_SEQ_VERIFY_FULL          2
+
+static unsigned int seq_verify = CS8409_SEQ_VERIFY_OFF;
+module_param(seq_verify, uint, 0644);
+MODULE_PARM_DESC(seq_verify, "CS8409 check logged sequence reads (0 = off, 1 = sampled, 2 = full)");
+
+static unsigned int seq_verify_interval = 16;
+module_param(seq_verify_interval, uint, 0644);
+MODULE_PARM_DESC(seq_verify_interval, "CS8409 sampled read check - check every Nth read");
+
+static void cs_8409_seq_verify_init(struct hda_codec *codec)
+{
+	struct cs_spec *spec = codec->spec;
+
+	spec->seq_verify = seq_verify;
+	spec->seq_verify_interval = seq_verify_interval;
+}
+
+// returns 1 if this logged read is to be checked against the hardware
+static int cs_8409_seq_verify_sample(struct hda_codec *codec)
+{
+	struct cs_spec *spec = codec->spec;
+
+	switch (spec->seq_verify) {
+	case CS8409_SEQ_VERIFY_OFF:
+		break;
+	case CS8409_SEQ_VERIFY_SAMPLED:
+		if (++spec->seq_verify_count >= max(spec->seq_verify_interval, 1U)) {
+			spec->seq_verify_count = 0;
+			return 1;
 		}
+		break;
+	default:
+		return 1;
 	}
+	spec->seq_skipped++;
+	return 0;
+}
 
-	cs_8409_vendor_enableI2Cclock(codec, 0x0);
-	// exit on error
+static void cs_8409_seq_verify_result(struct hda_codec *codec, int srcidx,
+                                      unsigned int retval, unsigned int expected)
+{
+	struct cs_spec *spec = codec->spec;
 
-        printk("snd_hda_intel: i2cWrite 0x%04x 0x%04x: 0x%04x %d end",i2c_address,i2c_reg,i2c_data,paged);
+	spec->seq_checks++;
+	if (retval == expected)
+		return;
+	spec->seq_mismatches++;
+	spec->seq_last_srcidx = srcidx;
+	spec->seq_last_val = retval;
+	spec->seq_last_expected = expected;
+}
 
-	//hda_set_node_power_state(codec, codec->core.afg, AC_PWRST_D3);
-	// exit on error
+// verbs that only read - 12 bit 0xfxx gets and the 4 bit 0xa-0xd ones
+static inline int cs_8409_verb_is_get(unsigned int verb)
+{
+	return (verb & 0xf00) == 0xf00 || (verb >= 0xa00 && verb <= 0xd00);
+}
 
-	return retval;
+// get verbs with a side effect that must reach the codec even when the
+// check is skipped - the GPIO data read is the Apple
+// readStatusAndClearInterrupt (reading clears the GPIO interrupt status)
+static inline int cs_8409_verb_must_read(unsigned int verb)
+{
+	return verb == AC_VERB_GET_GPIO_DATA;
+}
+
+static int cs_8409_seq_verify_stats_show(struct seq_file *m, void *v)
+{
+	struct hda_codec *codec = m->private;
+	struct cs_spec *spec = codec->spec;
+
+	seq_printf(m, "level: %u\n", spec->seq_verify);
+	seq_printf(m, "checked: %u\n", spec->seq_checks);
+	seq_printf(m, "mismatched: %u\n", spec->seq_mismatches);
+	seq_printf(m, "unchecked: %u\n", spec->seq_skipped);
+	if (spec->seq_mismatches)
+		seq_printf(m, "last mismatch at %u: 0x%08x expected 0x%08x\n",
+			   spec->seq_last_srcidx, spec->seq_last_val, spec->seq_last_expected);
+
+	return 0;
+}
+
+static int cs_8409_seq_verify_stats_open(struct inode *inode, struct file *file)
+{
+	return single_open(file, cs_8409_seq_verify_stats_show, inode->i_private);
+}
+
+static const struct file_operations cs_8409_seq_verify_stats_fops = {
+	.owner = THIS_MODULE,
+	.open = cs_8409_seq_verify_stats_open,
+	.read = seq_read,
+	.llseek = seq_lseek,
+	.release = single_release,
+};
+
+static void cs_8409_debugfs_init(struct hda_codec *codec)
+{
+	struct cs_spec *spec = codec->spec;
+	char name[48];
+
+	snprintf(name, sizeof(name), "cs8409-%s", dev_name(hda_codec_dev(codec)));
+	spec->debugfs_root = debugfs_create_dir(name, NULL);
+	if (IS_ERR_OR_NULL(spec->debugfs_root)) {
+		spec->debugfs_root = NULL;
+		return;
+	}
+
+	debugfs_create_file("i2c_wait_stats", 0444, spec->debugfs_root, codec,
+			    &cs_8409_i2c_wait_stats_fops);
+	debugfs_create_file("amp_dump", 0400, spec->debugfs_root, codec,
+			    &cs_8409_amp_dump_fops);
+	debugfs_create_u32("seq_verify", 0644, spec->debugfs_root, &spec->seq_verify);
+	debugfs_create_u32("seq_verify_interval", 0644, spec->debugfs_root, &spec->seq_verify_interval);
+	debugfs_create_file("seq_verify_stats", 0444, spec->debugfs_root, codec,
+			    &cs_8409_seq_verify_stats_fops);
+}
+
+static void cs_8409_debugfs_free(struct hda_codec *codec)
+{
+	struct cs_spec *spec = codec->spec;
+
+	debugfs_remove_recursive(spec->debugfs_root);
+	spec->debugfs_root = NULL;
 }
 
 
@@ -401,14 +2005,40 @@ static const struct hda_verb cs8409_init_verbs[] = {
         {} /* terminator */
 };
 
+// the replayed Apple sequences are tables of these ops run by snd_hda_coef_sequence
+// rather than straight line calls - 12 bytes an op instead of a call site each
+// write is the op code - 0/1/2 are the original coef read/write/write mask
+// GPIO mask/direction/data are plain verbs on the afg
+//   op                       nid            idx         param       retdata
+//   0/1/2 coef               vendor node    coef index  value       expected value
+//   CS8409_SEQ_VERB          node           verb        parameter   -
+//   CS8409_SEQ_VERB_CHECK    node           verb        parameter   expected value
+//   CS8409_SEQ_POWER         node           -           AC_PWRST_*  -
+//   CS8409_SEQ_I2C_WRITE     i2c address    register    data        paged
+//   CS8409_SEQ_I2C_READ      i2c address    register    -           paged
+//   CS8409_SEQ_DELAY         -              -           us          -
+// srcidx is the line in the Apple log for the BAD return messages
 struct hda_coef {
-        u16 write;
-        hda_nid_t nid;
-        u32 idx;
-        u32 param;
+        u8 write;
+        u8 nid;
+        u16 idx;
+        u16 param;
         u32 retdata;
-        int srcidx;
-};
+        u16 srcidx;
+} __packed;
+
+#define CS8409_SEQ_COEF_READ    0
+#define CS8409_SEQ_COEF_WRITE   1
+#define CS8409_SEQ_COEF_MASK    2
+#define CS8409_SEQ_VERB         3
+#define CS8409_SEQ_VERB_CHECK   4
+#define CS8409_SEQ_POWER        5
+#define CS8409_SEQ_I2C_WRITE    6
+#define CS8409_SEQ_I2C_READ     7
+#define CS8409_SEQ_DELAY        8
+
+// nid for the audio function group - codec->core.afg at run time
+#define CS8409_SEQ_AFG          0xff
 
 // new feature to do a sequence of coef read/writes
 // (seems to be used a lot for cs8409)
@@ -424,52 +2054,131 @@ void snd_hda_coef_item(struct hda_codec *codec, u16 write_flag, hda_nid_t nid, u
 {
         if (write_flag == 2)
 	{
-                unsigned int retval = cs_8409_vendor_coef_set_mask(codec, idx, param, 0);
-                if (retval != retdata)
-		{
-                        if (srcidx > 0)
-                                codec_dbg(codec, "command nid BAD mask return value at %d: 0x%08x 0x%08x\n",srcidx,retval,retdata);
-                        else
-                                codec_dbg(codec, "command nid BAD mask return value: 0x%08x 0x%08x\n",retval,retdata);
-		}
+                // the Apple logs only give the value written not the mask - so write all bits
+                // a check compares the codec (not the shadow) with the log
+                if (cs_8409_seq_verify_sample(codec))
+                        cs_8409_seq_verify_result(codec, srcidx,
+                                                  cs_8409_vendor_coef_get_uncached(codec, idx), retdata);
+                cs_8409_vendor_coef_set_mask(codec, idx, param, 0xffff);
 	}
         else if (write_flag == 1)
                 cs_8409_vendor_coef_set(codec, idx, param);
         else
 	{
-                unsigned int retval = cs_8409_vendor_coef_get(codec, idx);
-                if (retval != retdata)
-		{
-                        if (srcidx > 0)
-                                codec_dbg(codec, "command nid BAD      return value at %d: 0x%08x 0x%08x\n",srcidx,retval,retdata);
-                        else
-                                codec_dbg(codec, "command nid BAD      return value: 0x%08x 0x%08x\n",retval,retdata);
-		}
+                unsigned int retval;
+                // the i2c engine status/data reads are part of the transaction
+                // (a poll waits for completion) so always done
+                if (!cs_8409_seq_verify_sample(codec)) {
+                        if (idx >= 0x59 && idx <= 0x5e)
+                                cs_8409_vendor_coef_get(codec, idx);
+                        return;
+                }
+                retval = cs_8409_vendor_coef_get_uncached(codec, idx);
+                cs_8409_seq_verify_result(codec, srcidx, retval, retdata);
+	}
+}
+
+// a read that is not checked is not done and returns -1
+// reads of set verbs (used for syncing) and GPIO data reads are always done
+static inline unsigned int snd_hda_codec_read_check(struct hda_codec *codec, hda_nid_t nid, int flags, unsigned int verb, unsigned int parm, unsigned int check_val, int srcidx)
+{
+	unsigned int retval;
+
+	// -1 rather than the logged value so it is never taken for the codec state
+	if (!cs_8409_seq_verify_sample(codec)) {
+		if (cs_8409_verb_is_get(verb) && !cs_8409_verb_must_read(verb))
+			return -1;
+		return snd_hda_codec_read(codec, nid, flags, verb, parm);
 	}
+
+	retval = snd_hda_codec_read(codec, nid, flags, verb, parm);
+
+	if (retval == -1)
+		return retval;
+
+	cs_8409_seq_verify_result(codec, srcidx, retval, check_val);
+
+	return retval;
+}
+
+// fast boot - the Apple widget factory reads the parameters of every node
+// (plus the virtual widgets and all the coefs) at boot, ~750 reads that
+// the hda core has already done (and cached) at probe
+// with fast_boot the probe tables (init_read_all_nodes, read_vendor_node,
+// read_coefs_all, read_virtual_widgets) are run writes only
+static bool fast_boot = 1;
+module_param(fast_boot, bool, 0644);
+MODULE_PARM_DESC(fast_boot, "CS8409 skip the Apple widget probe reads at boot (writes are still done)");
+
+// run nseq ops from seq
+// writes_only skips the ops that only read - coef reads and get verb checks
+static void cs_8409_coef_sequence_run(struct hda_codec *codec, const struct hda_coef *seq, int nseq,
+                                      char *prtstr, int writes_only)
+{
+        struct cs_spec *spec = codec->spec;
+        const struct hda_coef *end = seq + nseq;
+        unsigned int mismatches = spec->seq_mismatches;
+        int skipped = 0;
+        hda_nid_t nid;
+
+	codec_dbg(codec, "start snd_hda_coef_sequence %s\n",prtstr);
+        for (; seq < end; seq++)
+        {
+                nid = (seq->nid == CS8409_SEQ_AFG) ? codec->core.afg : seq->nid;
+
+                if (writes_only && (seq->write == CS8409_SEQ_COEF_READ ||
+                                    (seq->write == CS8409_SEQ_VERB_CHECK && cs_8409_verb_is_get(seq->idx) &&
+                                     !cs_8409_verb_must_read(seq->idx)))) {
+                        skipped++;
+                        continue;
+                }
+
+                switch (seq->write) {
+                case CS8409_SEQ_COEF_READ:
+                case CS8409_SEQ_COEF_WRITE:
+                case CS8409_SEQ_COEF_MASK:
+		        snd_hda_coef_item(codec, seq->write, nid, seq->idx, seq->param, seq->retdata, seq->srcidx);
+                        break;
+                case CS8409_SEQ_VERB:
+                        snd_hda_codec_write(codec, nid, 0, seq->idx, seq->param);
+                        break;
+                case CS8409_SEQ_VERB_CHECK:
+                        snd_hda_codec_read_check(codec, nid, 0, seq->idx, seq->param, seq->retdata, seq->srcidx);
+                        break;
+                case CS8409_SEQ_POWER:
+                        hda_set_node_power_state(codec, nid, seq->param);
+                        break;
+                case CS8409_SEQ_I2C_WRITE:
+                        cs_8409_vendor_i2cWrite(codec, seq->nid, seq->idx, seq->param, seq->retdata);
+                        break;
+                case CS8409_SEQ_I2C_READ:
+                        cs_8409_vendor_i2cRead(codec, seq->nid, seq->idx, seq->retdata);
+                        break;
+                case CS8409_SEQ_DELAY:
+                        usleep_range(seq->param, seq->param + 100);
+                        break;
+                default:
+                        codec_err(codec, "snd_hda_coef_sequence %s bad op %d\n", prtstr, seq->write);
+                        break;
+                }
+        }
+	if (spec->seq_mismatches != mismatches)
+		codec_dbg(codec, "snd_hda_coef_sequence %s: %u read check mismatches\n",
+			  prtstr, spec->seq_mismatches - mismatches);
+	if (skipped)
+		codec_dbg(codec, "snd_hda_coef_sequence %s: %d reads skipped\n", prtstr, skipped);
+	codec_dbg(codec, "end   snd_hda_coef_sequence %s\n",prtstr);
 }
 
-void snd_hda_coef_sequence(struct hda_codec *codec, const struct hda_coef *seq, char *prtstr)
+void snd_hda_coef_sequence(struct hda_codec *codec, const struct hda_coef *seq, int nseq, char *prtstr)
 {
-	dev_info(hda_codec_dev(codec), "start snd_hda_coef_sequence %s\n",prtstr);
-        for (; seq->nid; seq++)
-        {
-		snd_hda_coef_item(codec, seq->write, seq->nid, seq->idx, seq->param, seq->retdata, seq->srcidx);
-        }
-	dev_info(hda_codec_dev(codec), "end   snd_hda_coef_sequence %s\n",prtstr);
+        cs_8409_coef_sequence_run(codec, seq, nseq, prtstr, 0);
 }
 
-static inline unsigned int snd_hda_codec_read_check(struct hda_codec *codec, hda_nid_t nid, int flags, unsigned int verb, unsigned int parm, unsigned int check_val, int srcidx)
+// the boot widget/coef probe tables - writes only with fast_boot
+void snd_hda_coef_sequence_probe(struct hda_codec *codec, const struct hda_coef *seq, int nseq, char *prtstr)
 {
-	unsigned int retval;
-	retval = snd_hda_codec_read(codec, nid, flags, verb, parm);
-
-	if (retval == -1)
-		return retval;
-
-	if (retval != check_val)
-        	codec_dbg(codec, "command nid BAD read check return value at %d: 0x%08x 0x%08x\n",srcidx,retval,check_val);
-
-	return retval;
+        cs_8409_coef_sequence_run(codec, seq, nseq, prtstr, fast_boot);
 }
 
 void snd_hda_double_reset(struct hda_codec *codec)
@@ -477,6 +2186,8 @@ void snd_hda_double_reset(struct hda_codec *codec)
 	dev_info(hda_codec_dev(codec), "snd_hda_double_reset\n");
 	// still not clear if this does anything
 	snd_hda_codec_write(codec, codec->core.afg, 0, 0xfff, 0);
+	cs_8409_vendor_coef_index_invalidate(codec);
+	cs_8409_vendor_coef_cache_invalidate(codec);
 	// so far the double reset seems to give bad results - lots of registers dont compare
 	//snd_hda_codec_write(codec, codec->core.afg, 0, AC_VERB_SET_CODEC_RESET, 0);
 	msleep(1);
@@ -505,60 +2216,286 @@ static void clear_pins(struct hda_codec *codec)
 static void read_coefs_all_loop(struct hda_codec *codec)
 {
 	//struct cs_spec *spec = codec->spec;
+	unsigned int vals[130];
 	int idx;
 	dev_info(hda_codec_dev(codec), "start read_coefs_all\n");
-	for (idx = 0; idx < 130; idx++)
+	cs_8409_vendor_coef_read_range(codec, 0, ARRAY_SIZE(vals), vals, 0);
+	for (idx = 0; idx < ARRAY_SIZE(vals); idx++)
 		{
-		int retval = cs_8409_vendor_coef_get(codec, idx);
-		dev_info(hda_codec_dev(codec),"snd_hda_intel: read_coefs_all 0x%02x:  0x%08x\n",idx,retval);
+		dev_info(hda_codec_dev(codec),"snd_hda_intel: read_coefs_all 0x%02x:  0x%08x\n",idx,vals[idx]);
 		}
 	dev_info(hda_codec_dev(codec), "end   read_coefs_all\n");
 }
 
-// this is very hacky but until get more understanding of what we can do with the 8409 setup
-// re-define these from hda_codec.c here
-// NOTA BENE - need to check this is consistent with any hda_codec.c updates!!
+#include "patch_cirrus_data84.h"
 
-/*
- * audio-converter setup caches
- */
-struct hda_cvt_setup {
-        hda_nid_t nid;
-        u8 stream_tag;
-        u8 channel_id;
-        u16 format_id;
-        unsigned char active;   /* cvt is currently used */
-        unsigned char dirty;    /* setups should be cleared */
-};
+#include "patch_cirrus_mb141_data84.h"
+
+#include "patch_cirrus_real84.h"
+
+#include "patch_cirrus_mb141_real84.h"
 
 
-/* get or create a cache entry for the given audio converter NID */
-static struct hda_cvt_setup *
-get_hda_cvt_setup_8409(struct hda_codec *codec, hda_nid_t nid)
+// board sequences from firmware
+// cs8409-<subsystem id>.bin (eg cs8409-106b3900.bin) can replace the built in
+// play and playstop sequences without rebuilding the module
+// it is requested without waiting at probe - the built in sequences stay in use
+// till it arrives (and if there is no file)
+// a boot sequence in the file does not replace the built in boot setup - it is
+// layered on top of it, run once at the first full play setup after the file
+// arrives and only if the built in boot succeeded
+// the file is parsed into struct hda_coef tables run by snd_hda_coef_sequence
+// and released straight away
+//
+// format version 1 - all little endian
+//   header   u32 magic "CS89"  u16 version  u16 nsections  u32 subsystem id
+//   section  u16 type (CS8409_FW_SEQ_*)  u16 flags (0)  u32 nops
+//            followed by nops 12 byte ops laid out as struct hda_coef
+
+static bool seq_firmware = 1;
+module_param(seq_firmware, bool, 0644);
+MODULE_PARM_DESC(seq_firmware, "CS8409 load board sequences from cs8409-<subsystem id>.bin");
+
+#define CS8409_FW_MAGIC         0x39385343      // "CS89"
+#define CS8409_FW_VERSION       1
+#define CS8409_FW_MAX_OPS       65536
+
+struct cs8409_fw_header {
+        __le32 magic;
+        __le16 version;
+        __le16 nsections;
+        __le32 subsystem_id;
+} __packed;
+
+struct cs8409_fw_section {
+        __le16 type;
+        __le16 flags;
+        __le32 nops;
+} __packed;
+
+struct cs8409_fw_op {
+        u8 write;
+        u8 nid;
+        __le16 idx;
+        __le16 param;
+        __le32 retdata;
+        __le16 srcidx;
+} __packed;
+
+static int cs_8409_fw_parse(struct hda_codec *codec, const u8 *data, size_t size)
 {
-        struct hda_cvt_setup *p;
-        int i;
+        struct cs_spec *spec = codec->spec;
+        const struct cs8409_fw_header *hdr = (const void *)data;
+        struct hda_coef *seqs[CS8409_FW_SEQ_MAX] = { NULL };
+        int nseqs[CS8409_FW_SEQ_MAX] = { 0 };
+        size_t pos;
+        int nsections, sect, type, i;
+        int err = 0;
+
+        if (size < sizeof(*hdr) || le32_to_cpu(hdr->magic) != CS8409_FW_MAGIC) {
+                codec_err(codec, "cs8409 firmware bad header\n");
+                return -EINVAL;
+        }
+        if (le16_to_cpu(hdr->version) != CS8409_FW_VERSION) {
+                codec_err(codec, "cs8409 firmware version %d not supported\n", le16_to_cpu(hdr->version));
+                return -EINVAL;
+        }
+        if (le32_to_cpu(hdr->subsystem_id) != codec->core.subsystem_id) {
+                codec_err(codec, "cs8409 firmware is for subsystem 0x%08x\n", le32_to_cpu(hdr->subsystem_id));
+                return -EINVAL;
+        }
+
+        nsections = le16_to_cpu(hdr->nsections);
+        pos = sizeof(*hdr);
+
+        for (sect = 0; sect < nsections; sect++) {
+                const struct cs8409_fw_section *sec;
+                const struct cs8409_fw_op *ops;
+                struct hda_coef *seq;
+                unsigned int nops;
+
+                if (size - pos < sizeof(*sec)) {
+                        err = -EINVAL;
+                        break;
+                }
+                sec = (const void *)(data + pos);
+                pos += sizeof(*sec);
+
+                type = le16_to_cpu(sec->type);
+                nops = le32_to_cpu(sec->nops);
+                if (type >= CS8409_FW_SEQ_MAX || nops > CS8409_FW_MAX_OPS ||
+                    nops > (size - pos) / sizeof(*ops)) {
+                        err = -EINVAL;
+                        break;
+                }
+                ops = (const void *)(data + pos);
+                pos += nops * sizeof(*ops);
+
+                seq = kcalloc(nops, sizeof(*seq), GFP_KERNEL);
+                if (!seq && nops) {
+                        err = -ENOMEM;
+                        break;
+                }
+
+                for (i = 0; i < nops; i++) {
+                        if (ops[i].write > CS8409_SEQ_DELAY) {
+                                codec_err(codec, "cs8409 firmware section %d bad op %d at %d\n", sect, ops[i].write, i);
+                                err = -EINVAL;
+                                break;
+                        }
+                        seq[i].write = ops[i].write;
+                        seq[i].nid = ops[i].nid;
+                        seq[i].idx = le16_to_cpu(ops[i].idx);
+                        seq[i].param = le16_to_cpu(ops[i].param);
+                        seq[i].retdata = le32_to_cpu(ops[i].retdata);
+                        seq[i].srcidx = le16_to_cpu(ops[i].srcidx);
+                }
+
+                // a later section of the same type replaces an earlier one
+                kfree(seqs[type]);
+                seqs[type] = seq;
+                nseqs[type] = nops;
+
+                if (err)
+                        break;
+        }
+
+        if (err) {
+                if (err == -EINVAL)
+                        codec_err(codec, "cs8409 firmware bad section %d\n", sect);
+                for (type = 0; type < CS8409_FW_SEQ_MAX; type++)
+                        kfree(seqs[type]);
+                return err;
+        }
 
-        for (i = 0; i < codec->cvt_setups.used; i++) {
-                p = snd_array_elem(&codec->cvt_setups, i);
-                if (p->nid == nid)
-                        return p;
+        mutex_lock(&spec->fw_mutex);
+        for (type = 0; type < CS8409_FW_SEQ_MAX; type++) {
+                if (!seqs[type])
+                        continue;
+                kfree(spec->fw_seq[type]);
+                spec->fw_seq[type] = seqs[type];
+                spec->fw_nseq[type] = nseqs[type];
+                codec_info(codec, "cs8409 firmware sequence %d: %d ops\n", type, nseqs[type]);
         }
-        p = snd_array_new(&codec->cvt_setups);
-        if (p)
-                p->nid = nid;
-        return p;
+        mutex_unlock(&spec->fw_mutex);
+
+        return 0;
 }
 
+// run a sequence from the firmware file if there is one - returns 1 if it ran
+static int cs_8409_fw_run(struct hda_codec *codec, int type)
+{
+        struct cs_spec *spec = codec->spec;
+        static char * const names[CS8409_FW_SEQ_MAX] = { "fw boot", "fw play", "fw playstop" };
+        int ran = 0;
 
-#include "patch_cirrus_data84.h"
+        mutex_lock(&spec->fw_mutex);
+        if (spec->fw_seq[type]) {
+                snd_hda_coef_sequence(codec, spec->fw_seq[type], spec->fw_nseq[type], names[type]);
+                ran = 1;
+        }
+        mutex_unlock(&spec->fw_mutex);
 
-#include "patch_cirrus_mb141_data84.h"
+        return ran;
+}
 
-#include "patch_cirrus_real84.h"
+static void cs_8409_fw_loaded(const struct firmware *fw, void *context)
+{
+        struct hda_codec *codec = context;
+        struct cs_spec *spec = codec->spec;
+        int err;
 
-#include "patch_cirrus_mb141_real84.h"
+        if (!fw) {
+                codec_dbg(codec, "cs8409 no sequence firmware - using built in sequences\n");
+                goto done;
+        }
 
+        err = cs_8409_fw_parse(codec, fw->data, fw->size);
+        release_firmware(fw);
+        if (err < 0)
+                goto done;
+
+        // the file can arrive at any time (even with a stream playing or
+        // before the built in boot setup has run) so the boot sequence is
+        // not run from here but at the start of the next full play setup
+        // - serialised with the rest of the amp/TDM setup
+        // see cs_8409_fw_run_boot
+        mutex_lock(&spec->fw_mutex);
+        if (spec->fw_seq[CS8409_FW_SEQ_BOOT])
+                spec->fw_boot_pending = 1;
+        mutex_unlock(&spec->fw_mutex);
+
+done:
+        complete(&spec->fw_done);
+}
+
+// run a firmware boot sequence left by cs_8409_fw_loaded
+// called from the full play setup (prepare with the i2c queue drained or the
+// pre-warm on the queue) before the play sequence
+static void cs_8409_fw_run_boot(struct hda_codec *codec)
+{
+        struct cs_spec *spec = codec->spec;
+        int run;
+
+        mutex_lock(&spec->fw_mutex);
+        // left pending till the built in boot setup has finished
+        if (!spec->fw_boot_pending || !spec->boot_queued || !completion_done(&spec->boot_done)) {
+                mutex_unlock(&spec->fw_mutex);
+                return;
+        }
+        spec->fw_boot_pending = 0;
+        // layered on the built in boot - not over a failed one
+        run = spec->boot_err >= 0 && spec->fw_seq[CS8409_FW_SEQ_BOOT];
+        mutex_unlock(&spec->fw_mutex);
+
+        if (!run) {
+                codec_dbg(codec, "cs8409 firmware boot sequence skipped - boot setup failed\n");
+                return;
+        }
+
+        codec_dbg(codec, "cs8409 running firmware boot sequence\n");
+        cs_8409_fw_run(codec, CS8409_FW_SEQ_BOOT);
+        // the sequence may drive the amps directly
+        cs_8409_amps_mark_dirty(codec);
+}
+
+static void cs_8409_fw_request(struct hda_codec *codec)
+{
+        struct cs_spec *spec = codec->spec;
+        char name[32];
+        int err;
+
+        if (!seq_firmware)
+                return;
+
+        snprintf(name, sizeof(name), "cs8409-%08x.bin", codec->core.subsystem_id);
+
+        err = request_firmware_nowait(THIS_MODULE, true, name, hda_codec_dev(codec),
+                                      GFP_KERNEL, codec, cs_8409_fw_loaded);
+        if (err < 0) {
+                codec_dbg(codec, "cs8409 request %s failed %d\n", name, err);
+                return;
+        }
+        spec->fw_requested = 1;
+}
+
+// wait out a pending load and drop the sequences
+static void cs_8409_fw_free(struct hda_codec *codec)
+{
+        struct cs_spec *spec = codec->spec;
+        int type;
+
+        if (spec->fw_requested) {
+                wait_for_completion(&spec->fw_done);
+                spec->fw_requested = 0;
+        }
+
+        for (type = 0; type < CS8409_FW_SEQ_MAX; type++) {
+                kfree(spec->fw_seq[type]);
+                spec->fw_seq[type] = NULL;
+                spec->fw_nseq[type] = 0;
+        }
+}
 
 // macbook pro subsystem ids
 // 14,1 0x106b3300
@@ -573,6 +2510,9 @@ static int cs_8409_boot_setup(struct hda_codec *codec)
 	int err = 0;
         struct cs_spec *spec = codec->spec;
 
+        // before the boot sequences set up the TDM slot table
+        cs_8409_vendor_coef_probe_autoinc(codec);
+
         // so it appears we break up the subsystem_id into 2 parts
         // a codec vendor id (16 bits) and a subvendor id (8 bits) plus an assembly id
         // so here the codec vendor is 0x106b, the subvendor id is 0x39 and the assembly id is 0x00
@@ -602,34 +2542,438 @@ static int cs_8409_boot_setup(struct hda_codec *codec)
                 err = -1;
         }
 
+	// the boot sequences drive the amps with raw coef writes as well
+	// so dont trust any cached amp/page state from before
+	cs_8409_amps_mark_dirty(codec);
+	mutex_lock(&spec->play_mutex);
+	spec->play_state = CS8409_PLAY_OFF;
+	mutex_unlock(&spec->play_mutex);
+
 	return err;
 }
 
+// async boot - the boot setup is queued on i2c_wq once the pcms are built
+// so the controller probe (and system boot) does not wait for the amps
+// the first prepare waits on boot_done if it has not finished
+// boot_async=0 still queues it but waits for it in build_pcms
+static bool boot_async = 1;
+module_param(boot_async, bool, 0644);
+MODULE_PARM_DESC(boot_async, "CS8409 run the amp/TDM boot setup in the background");
+
+// the boot setup now runs after cs_8409_init and build_controls so it lands
+// on top of the generic setup - the data boot resets the AFG (losing the pin
+// controls, amp mutes and unsol enables) and the real boot leaves its own
+// pin and converter toggles behind
+// re-apply the generic init from the (dirtied) codec register cache after
+// so the mixer/pin state and any mixer puts or jack changes made while the
+// boot was running end up in the hardware
+static void cs_8409_boot_resync(struct hda_codec *codec)
+{
+	regcache_mark_dirty(codec->core.regmap);
+	snd_hda_gen_init(codec);
+	cs_8409_vendor_coef_cache_flush(codec);
+	snd_hda_jack_report_sync(codec);
+}
+
+static void cs_8409_boot_work(struct work_struct *work)
+{
+	struct cs_spec *spec = container_of(work, struct cs_spec, boot_work);
+	struct hda_codec *codec = spec->codec;
+	int err;
+
+	snd_hda_power_up(codec);
+	err = cs_8409_boot_setup(codec);
+	cs_8409_boot_resync(codec);
+	snd_hda_power_down(codec);
+
+	spec->boot_err = err;
+	if (err < 0)
+		codec_err(codec, "cs8409 boot setup failed %d - amp i2c bus not exposed\n", err);
+	else
+		// only expose the i2c bus once the amps have been through boot setup
+		cs_8409_i2c_adapter_init(codec);
+
+	complete_all(&spec->boot_done);
+}
+
+static void cs_8409_boot_queue(struct hda_codec *codec)
+{
+	struct cs_spec *spec = codec->spec;
+
+	if (spec->boot_queued)
+		return;
+	spec->boot_queued = 1;
+
+	queue_work(spec->i2c_wq, &spec->boot_work);
+
+	if (!boot_async)
+		flush_work(&spec->boot_work);
+}
+
+static void cs_8409_boot_wait(struct hda_codec *codec)
+{
+	struct cs_spec *spec = codec->spec;
+
+	if (completion_done(&spec->boot_done))
+		return;
+
+	codec_dbg(codec, "cs8409 waiting for boot setup\n");
+	wait_for_completion(&spec->boot_done);
+}
+
+// at free - finish a running boot and release anyone waiting on one that never ran
+static void cs_8409_boot_sync(struct hda_codec *codec)
+{
+	struct cs_spec *spec = codec->spec;
+
+	if (spec->boot_queued)
+		flush_work(&spec->boot_work);
+	complete_all(&spec->boot_done);
+}
+
 static void cs_8409_play_data(struct hda_codec *codec);
-static void cs_8409_play_real(struct hda_codec *codec);
+static int cs_8409_play_real(struct hda_codec *codec);
 
-void cs_8409_play_setup(struct hda_codec *codec)
+// amp global enable - MAX98706 GlobalEnable 0x50, SSM3515 PowerControl 0x00 (bit 0 power down)
+static int cs_8409_amps_enable(struct hda_codec *codec, int enable)
 {
-        struct cs_spec *spec = codec->spec;
+        struct cs8409_i2c_op op = { 0 };
+        const unsigned int *addresses;
+        int status[4];
+        int err;
+        int i;
+
         if (codec->core.subsystem_id == 0x106b3900) {
+                addresses = cs_8409_max98706_addresses;
+                op.reg = 0x0050;
+                op.data = enable ? 0x0001 : 0x0000;
+        }
+        else if (codec->core.subsystem_id == 0x106b3300) {
+                addresses = cs_8409_ssm3515_addresses;
+                op.reg = 0x0000;
+                op.data = enable ? 0x0000 : 0x0001;
+                op.paged = 1;
+        }
+        else {
+                printk("snd_hda_intel: UNKNOWN subsystem id 0x%08x",codec->core.subsystem_id);
+                return -ENODEV;
+        }
+        op.write = 1;
+
+        err = cs_8409_amp_regmap_broadcast(codec, addresses, ARRAY_SIZE(status), &op, 1, 0, status);
+
+        for (i = 0; i < ARRAY_SIZE(status); i++)
+                if (status[i])
+                        codec_err(codec, "amp 0x%02x %s failed %d\n", addresses[i],
+                                  enable ? "enable" : "disable", status[i]);
+
+        return err;
+}
+
+// amp enable from the pcm trigger - the TDM path and amp programming are done
+// at prepare (or kept from the last stream) and START/STOP only toggle the amp
+// enable register so the speakers follow the stream without touching the path
+// the trigger is atomic so it only records what is wanted and the i2c writes
+// are done by amp_work on the i2c queue
+static bool amp_trigger = 1;
+module_param(amp_trigger, bool, 0644);
+MODULE_PARM_DESC(amp_trigger, "CS8409 enable/disable the amps from the pcm trigger");
+
+static void cs_8409_amp_work(struct work_struct *work)
+{
+        struct cs_spec *spec = container_of(work, struct cs_spec, amp_work);
+        struct hda_codec *codec = spec->codec;
+        int want = atomic_read(&spec->amp_want);
+
+        mutex_lock(&spec->play_mutex);
+        if (want && spec->play_state == CS8409_PLAY_CONFIGURED) {
+                if (cs_8409_amps_enable(codec, 1) >= 0)
+                        spec->play_state = CS8409_PLAY_ENABLED;
+        } else if (!want && spec->play_state == CS8409_PLAY_ENABLED) {
+                if (cs_8409_amps_enable(codec, 0) >= 0)
+                        spec->play_state = CS8409_PLAY_CONFIGURED;
+        }
+        mutex_unlock(&spec->play_mutex);
+}
+
+// the controller ops with our trigger - one per hooked substream so each
+// keeps its own original ops (runtime->private_data is the controller's)
+struct cs8409_play_ops {
+        struct snd_pcm_ops ops;
+        const struct snd_pcm_ops *orig;
+        struct hda_codec *codec;
+};
+
+static int cs_8409_play_trigger(struct snd_pcm_substream *substream, int cmd)
+{
+        struct cs8409_play_ops *play_ops = container_of(substream->ops, struct cs8409_play_ops, ops);
+        struct cs_spec *spec = play_ops->codec->spec;
+        int err;
+
+        err = play_ops->orig->trigger(substream, cmd);
+        if (err < 0)
+                return err;
+
+        switch (cmd) {
+        case SNDRV_PCM_TRIGGER_START:
+        case SNDRV_PCM_TRIGGER_PAUSE_RELEASE:
+        case SNDRV_PCM_TRIGGER_RESUME:
+                atomic_set(&spec->amp_want, 1);
+                break;
+        case SNDRV_PCM_TRIGGER_STOP:
+        case SNDRV_PCM_TRIGGER_PAUSE_PUSH:
+        case SNDRV_PCM_TRIGGER_SUSPEND:
+                atomic_set(&spec->amp_want, 0);
+                break;
+        default:
+                return 0;
+        }
+
+        queue_work(spec->i2c_wq, &spec->amp_work);
+
+        return 0;
+}
+
+static int cs_8409_play_trigger_hooked(struct snd_pcm_substream *substream)
+{
+        return substream->ops && substream->ops->trigger == cs_8409_play_trigger;
+}
+
+// the hda pcm ops have no trigger so wrap the controller one for this substream
+// if this fails the amps are left to the prepare as without amp_trigger
+static void cs_8409_play_trigger_hook(struct hda_codec *codec, struct snd_pcm_substream *substream)
+{
+        struct cs_spec *spec = codec->spec;
+        struct cs8409_play_ops *play_ops;
+
+        if (!amp_trigger || !spec->i2c_wq || cs_8409_play_trigger_hooked(substream))
+                return;
+
+        play_ops = kmalloc(sizeof(*play_ops), GFP_KERNEL);
+        if (!play_ops)
+                return;
+
+        play_ops->ops = *substream->ops;
+        play_ops->ops.trigger = cs_8409_play_trigger;
+        play_ops->orig = substream->ops;
+        play_ops->codec = codec;
+        substream->ops = &play_ops->ops;
+}
+
+static void cs_8409_play_trigger_unhook(struct hda_codec *codec, struct snd_pcm_substream *substream)
+{
+        struct cs8409_play_ops *play_ops;
+
+        if (!cs_8409_play_trigger_hooked(substream))
+                return;
+
+        play_ops = container_of(substream->ops, struct cs8409_play_ops, ops);
+        substream->ops = play_ops->orig;
+        kfree(play_ops);
+}
+
+// deferred shutdown - a stop only disables the amps (leaving the TDM path
+// configured) and the full shutdown (TDM down, AFG D3) is done once the
+// stream has been idle for play_idle_ms so frequent short sounds dont go
+// through the whole amp power sequence each time
+// a pending shutdown holds a power reference so the codec stays up with it
+// and runs on i2c_wq
+static unsigned int play_idle_ms = 3000;
+module_param(play_idle_ms, uint, 0644);
+MODULE_PARM_DESC(play_idle_ms, "CS8409 idle time after a stop before the amps/TDM are shut down (ms, 0 = immediately)");
+
+// a new prepare - the path is wanted again
+static void cs_8409_play_off_cancel(struct hda_codec *codec)
+{
+        struct cs_spec *spec = codec->spec;
+
+        if (cancel_delayed_work_sync(&spec->play_off_work))
+                snd_hda_power_down(codec);
+}
+
+// warm start - the full play setup (TDM path, amp programming, converter sync)
+// is only needed when the path is down or the stream rate has changed
+// a re-prepare (seek, xrun recovery, stream restart) at the same rate only
+// re-enables the amps if they were disabled (left to the START trigger with
+// amp_trigger) or does nothing if still running
+// only the rate is compared - the TDM setup is fixed 4ch and the 8409 handles
+// the S24_LE/S32_LE and channel count differences of the stream itself
+#define CS8409_PLAY_RATE_MASK (AC_FMT_BASE_44K | AC_FMT_MULT_MASK | AC_FMT_DIV_MASK)
+
+// the format the OSX setup programs - 44.1kHz 24 bit 4ch
+#define CS8409_PLAY_DEFAULT_FORMAT 0x4033
+
+// the firmware and OSX data sequences write the converter format/stream ids
+// directly - clean up the converters through the hda core after so its
+// cvt_setups cache matches and the prepare writes the real format and tag
+// (the real setup does this itself - see play_sync_converters_on)
+// from a worker this is left to the next prepare
+static void cs_8409_play_cvt_resync(struct hda_codec *codec)
+{
+        struct cs_spec *spec = codec->spec;
+
+        if (spec->play_in_worker) {
+                spec->play_cvt_resync = 1;
+                return;
+        }
+
+        __snd_hda_codec_cleanup_stream(codec, 0x02, 1);
+        __snd_hda_codec_cleanup_stream(codec, 0x03, 1);
+        spec->play_cvt_resync = 0;
+}
+
+// stop a converter (stream id and format 0) for the coef 0x17 sync
+// through the hda core in pcm context - from a worker the core cvt_setups
+// must not be touched (it can grow under a running prepare) so the verbs
+// are written directly and the prepare resyncs the core cache
+static void cs_8409_play_cvt_stop(struct hda_codec *codec, hda_nid_t nid)
+{
+        struct cs_spec *spec = codec->spec;
+
+        if (!spec->play_in_worker) {
+                __snd_hda_codec_cleanup_stream(codec, nid, 1);
+                return;
+        }
+
+        snd_hda_codec_write(codec, nid, 0, AC_VERB_SET_CHANNEL_STREAMID, 0);
+        snd_hda_codec_write(codec, nid, 0, AC_VERB_SET_STREAM_FORMAT, 0);
+        spec->play_cvt_resync = 1;
+}
+
+// called with play_mutex held
+// the path only counts as up (ENABLED) once the amps took their setup - a
+// failed one is left OFF so the next prepare runs the full setup again
+// (the replayed data and firmware sequences have no status so are taken as done)
+static int cs_8409_play_setup_full(struct hda_codec *codec, unsigned int format)
+{
+        struct cs_spec *spec = codec->spec;
+        int err = 0;
+
+        cs_8409_fw_run_boot(codec);
+
+        spec->play_state = CS8409_PLAY_OFF;
+
+        if (cs_8409_fw_run(codec, CS8409_FW_SEQ_PLAY)) {
+                cs_8409_play_cvt_resync(codec);
+        }
+        else if (codec->core.subsystem_id == 0x106b3900) {
 		if (spec->use_data) {
                         //cs_8409_unmute_data(codec);
                         //cs_8409_volup_data(codec);
                         cs_8409_play_data(codec);
+                        cs_8409_play_cvt_resync(codec);
 		} else {
-		        cs_8409_play_real(codec);
+		        err = cs_8409_play_real(codec);
                 }
 	}
 	else if (codec->core.subsystem_id == 0x106b3300) {
 		if (spec->use_data) {
                        cs_8409_play_data_ssm3(codec);
+                       cs_8409_play_cvt_resync(codec);
 		} else {
-                       cs_8409_play_real_ssm3(codec);
+                       err = cs_8409_play_real_ssm3(codec);
 		}
 	}
 	else {
                 printk("snd_hda_intel: UNKNOWN subsystem id 0x%08x",codec->core.subsystem_id);
+                err = -ENODEV;
 	}
+
+        if (err < 0) {
+                codec_err(codec, "cs8409 play setup failed %d\n", err);
+                return err;
+        }
+
+        spec->play_state = CS8409_PLAY_ENABLED;
+        spec->play_format = format;
+
+        return 0;
+}
+
+// amp_trig - the substream trigger enables the amps (see cs_8409_play_trigger_hook)
+void cs_8409_play_setup(struct hda_codec *codec, unsigned int format, int amp_trig)
+{
+        struct cs_spec *spec = codec->spec;
+
+        cs_8409_play_off_cancel(codec);
+
+        // finish any background amp shutdown from the last stop
+        // or the pre-warm from the open first
+        // (not under play_mutex - the queued work takes it)
+        cs_8409_i2c_queue_drain(codec);
+
+        mutex_lock(&spec->play_mutex);
+
+        // converters stopped by the pre-warm or idle shutdown worker
+        if (spec->play_cvt_resync)
+                cs_8409_play_cvt_resync(codec);
+
+        if (spec->play_state != CS8409_PLAY_OFF &&
+            (spec->play_format & CS8409_PLAY_RATE_MASK) == (format & CS8409_PLAY_RATE_MASK)) {
+                // with amp_trigger the START enables them
+                if (spec->play_state == CS8409_PLAY_CONFIGURED && !amp_trig &&
+                    cs_8409_amps_enable(codec, 1) >= 0)
+                        spec->play_state = CS8409_PLAY_ENABLED;
+                codec_dbg(codec, "cs8409 play warm start format 0x%04x state %d\n", format, spec->play_state);
+                if (spec->play_state == CS8409_PLAY_ENABLED || amp_trig)
+                        goto done;
+        }
+
+        cs_8409_play_setup_full(codec, format);
+
+done:
+        mutex_unlock(&spec->play_mutex);
+}
+
+// pre-warm - applications open, set hw_params, prepare and start in quick
+// succession so start the amp/TDM bring-up at the open on the i2c queue
+// for the default format and let it overlap the hw_params negotiation
+// the prepare drains the queue and only redoes the setup if the rate differs
+static bool play_prewarm = 1;
+module_param(play_prewarm, bool, 0644);
+MODULE_PARM_DESC(play_prewarm, "CS8409 start the amp/TDM setup at pcm open (0 = at prepare)");
+
+static void cs_8409_play_prewarm_work(struct work_struct *work)
+{
+        struct cs_spec *spec = container_of(work, struct cs_spec, prewarm_work);
+        struct hda_codec *codec = spec->codec;
+
+        mutex_lock(&spec->play_mutex);
+
+        // already up from the last stream (waiting for the idle shutdown)
+        // or queued behind the boot setup - dont bring up a failed boot
+        if (spec->play_state != CS8409_PLAY_OFF ||
+            (spec->boot_queued && spec->boot_err < 0))
+                goto done;
+
+        snd_hda_power_up(codec);
+
+        codec_dbg(codec, "cs8409 play pre-warm format 0x%04x\n", CS8409_PLAY_DEFAULT_FORMAT);
+
+        // amps stay off till the START with amp_trigger
+        spec->play_in_worker = 1;
+        if (cs_8409_play_setup_full(codec, CS8409_PLAY_DEFAULT_FORMAT) >= 0 &&
+            amp_trigger && cs_8409_amps_enable(codec, 0) >= 0)
+                spec->play_state = CS8409_PLAY_CONFIGURED;
+        spec->play_in_worker = 0;
+
+        snd_hda_power_down(codec);
+
+done:
+        mutex_unlock(&spec->play_mutex);
+}
+
+static void cs_8409_play_prewarm(struct hda_codec *codec)
+{
+        struct cs_spec *spec = codec->spec;
+
+        if (!play_prewarm || !spec->i2c_wq)
+                return;
+
+        // the path is wanted again - keep it up if still there
+        cs_8409_play_off_cancel(codec);
+
+        queue_work(spec->i2c_wq, &spec->prewarm_work);
 }
 
 static void cs_8409_playstop_data(struct hda_codec *codec);
@@ -638,9 +2982,16 @@ static void cs_8409_playstop_real(struct hda_codec *codec);
 //static void cs_8409_playstop_data_ssm3(struct hda_codec *codec);
 static void cs_8409_playstop_real_ssm3(struct hda_codec *codec);
 
+// called with play_mutex held
 void cs_8409_play_cleanup(struct hda_codec *codec)
 {
         struct cs_spec *spec = codec->spec;
+
+        spec->play_state = CS8409_PLAY_OFF;
+
+        if (cs_8409_fw_run(codec, CS8409_FW_SEQ_PLAYSTOP))
+                return;
+
         if (codec->core.subsystem_id == 0x106b3900) {
 		if (spec->use_data) {
                        cs_8409_playstop_data(codec);
@@ -661,8 +3012,95 @@ void cs_8409_play_cleanup(struct hda_codec *codec)
 
 }
 
+static void cs_8409_play_off_work(struct work_struct *work)
+{
+        struct cs_spec *spec = container_of(work, struct cs_spec, play_off_work.work);
+        struct hda_codec *codec = spec->codec;
+
+        codec_dbg(codec, "cs8409 idle - shutting down amps/TDM\n");
+        mutex_lock(&spec->play_mutex);
+        spec->play_in_worker = 1;
+        cs_8409_play_cleanup(codec);
+        spec->play_in_worker = 0;
+        mutex_unlock(&spec->play_mutex);
+
+        snd_hda_power_down(codec);
+}
+
+// stream cleanup - disable the amps now and leave the rest for play_off_work
+static void cs_8409_play_cleanup_deferred(struct hda_codec *codec)
+{
+        struct cs_spec *spec = codec->spec;
+        int pending;
+
+        // a stop while the last one is still waiting restarts the idle time
+        pending = cancel_delayed_work_sync(&spec->play_off_work);
+
+        // let a trigger amp disable finish first
+        cs_8409_i2c_queue_drain(codec);
+
+        mutex_lock(&spec->play_mutex);
+
+        if (!play_idle_ms || spec->play_state == CS8409_PLAY_OFF) {
+                cs_8409_play_cleanup(codec);
+                mutex_unlock(&spec->play_mutex);
+                if (pending)
+                        snd_hda_power_down(codec);
+                return;
+        }
+
+        if (spec->play_state == CS8409_PLAY_ENABLED && cs_8409_amps_enable(codec, 0) >= 0)
+                spec->play_state = CS8409_PLAY_CONFIGURED;
+
+        mutex_unlock(&spec->play_mutex);
+
+        if (!pending)
+                snd_hda_power_up(codec);
+        // on the i2c queue so it stays in order with the amp work from the stop
+        queue_delayed_work(spec->i2c_wq, &spec->play_off_work, msecs_to_jiffies(play_idle_ms));
+}
+
+// a pending shutdown at suspend (pm set) is run now so the amps and TDM
+// path go down in order before the codec does - at free it is just dropped
+static void cs_8409_play_off_flush(struct hda_codec *codec, int pm)
+{
+        struct cs_spec *spec = codec->spec;
+
+        if (!cancel_delayed_work_sync(&spec->play_off_work))
+                return;
+
+        if (pm) {
+                mutex_lock(&spec->play_mutex);
+                cs_8409_play_cleanup(codec);
+                mutex_unlock(&spec->play_mutex);
+                snd_hda_power_down_pm(codec);
+        }
+        else
+                snd_hda_power_down(codec);
+}
+
+// opened (pre-warmed) but never prepared - no cleanup came for the path
+// so start the idle shutdown here
+static void cs_8409_play_prewarm_close(struct hda_codec *codec)
+{
+        struct cs_spec *spec = codec->spec;
+        int up;
+
+        if (!play_prewarm || !spec->i2c_wq)
+                return;
+
+        flush_work(&spec->prewarm_work);
+
+        mutex_lock(&spec->play_mutex);
+        up = spec->play_state != CS8409_PLAY_OFF;
+        mutex_unlock(&spec->play_mutex);
+
+        if (up && !delayed_work_pending(&spec->play_off_work))
+                cs_8409_play_cleanup_deferred(codec);
+}
+
 static void cs_8409_pcm_playback_pre_prepare_hook(struct hda_pcm_stream *hinfo, struct hda_codec *codec, struct snd_pcm_substream *substream,
-                               int action)
+                               unsigned int format, int action)
 {
 	struct cs_spec *spec = codec->spec;
 
@@ -676,7 +3114,8 @@ static void cs_8409_pcm_playback_pre_prepare_hook(struct hda_pcm_stream *hinfo,
 			struct timespec curtim;
 			getnstimeofday(&curtim);
 			spec->first_play_time.tv_sec = curtim.tv_sec;
-			cs_8409_play_setup(codec);
+			cs_8409_boot_wait(codec);
+			cs_8409_play_setup(codec, format, cs_8409_play_trigger_hooked(substream));
 			printk("snd_hda_intel: command nid cs_8409_playback_pcm_hook setup play called");
 			spec->play_init = 1;
 			spec->playing = 0;
@@ -703,8 +3142,9 @@ static void cs_8409_playback_pcm_hook(struct hda_pcm_stream *hinfo, struct hda_c
 
 
 	if (action == HDA_GEN_PCM_ACT_OPEN) {
-		//struct hda_cvt_setup *p = NULL;
 		printk("snd_hda_intel: command nid cs_8409_playback_pcm_hook open");
+		cs_8409_play_trigger_hook(codec, substream);
+		cs_8409_play_prewarm(codec);
 
 		printk("snd_hda_intel: command nid cs_8409_playback_pcm_hook open end");
 	} else if (action == HDA_GEN_PCM_ACT_PREPARE) {
@@ -728,7 +3168,7 @@ static void cs_8409_playback_pcm_hook(struct hda_pcm_stream *hinfo, struct hda_c
         	power_chk = snd_hda_codec_read(codec, codec->core.afg, 0, AC_VERB_GET_POWER_STATE, 0);
 		printk("snd_hda_intel: command nid cs_8409_playback_pcm_hook power check 0x01 3 %d", power_chk);
 		//if (spec->playing) {
-			cs_8409_play_cleanup(codec);
+			cs_8409_play_cleanup_deferred(codec);
 			printk("snd_hda_intel: command nid cs_8409_playback_pcm_hook done play down");
 			spec->playing = 0;
 		//}
@@ -738,6 +3178,8 @@ static void cs_8409_playback_pcm_hook(struct hda_pcm_stream *hinfo, struct hda_c
 		printk("snd_hda_intel: command nid cs_8409_playback_pcm_hook HOOK CLEANUP end");
 	} else if (action == HDA_GEN_PCM_ACT_CLOSE) {
 		printk("snd_hda_intel: command nid cs_8409_playback_pcm_hook close");
+		cs_8409_play_trigger_unhook(codec, substream);
+		cs_8409_play_prewarm_close(codec);
 		printk("snd_hda_intel: command nid cs_8409_playback_pcm_hook close end");
 	}
 
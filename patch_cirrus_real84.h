@@ -1,39 +1,45 @@
 
 static int tdm_in_use(struct hda_codec *codec, int where_flag)
 {
-        int coef_ret = 0;
+        unsigned int coef_rets[CS8409_TDM_SLOTS];
         int coef_idx = 0;
+        int in_use, hw_in_use = 0;
 
         // re-implementation of AppleHDATDMBusManagerCS8409::tdmInUse
 	dev_info(hda_codec_dev(codec), "command tdmInUse start %d\n", where_flag);
 
+        // the slot state is tracked from the slot coef writes - no codec traffic
+        in_use = cs_8409_vendor_tdm_in_use(codec);
+        if (in_use >= 0 && !tdm_scan) {
+	        dev_info(hda_codec_dev(codec), "command tdmInUse %d end %d\n", in_use, where_flag);
+                return in_use;
+        }
+
         // note on OSX the coef get functions returns a status value with read value stored in passed address
         // on linux it seems -1 is an error return
 
-        coef_ret = cs_8409_vendor_coef_get(codec, 0x19);
+        // Apple reads one coef at a time till it finds a slot in use
+        // read the whole slot table in one auto increment burst instead
+        // for tdm_scan go to the codec rather than the coef shadow
 
-        //if (coef_ret == -1) error;
+        cs_8409_vendor_coef_read_range(codec, CS8409_TDM_SLOT_FIRST, ARRAY_SIZE(coef_rets), coef_rets, !tdm_scan);
 
-        coef_idx = 0x1a;
+        for (coef_idx = 0; coef_idx < ARRAY_SIZE(coef_rets); coef_idx++) {
 
-        do {
+                //if (coef_rets[coef_idx] == -1) error;
 
-                if ((short)coef_ret >= 0) {
-	            dev_info(hda_codec_dev(codec), "command tdmInUse 1 end %d\n", where_flag);
-                    return 1;
+                if ((short)coef_rets[coef_idx] >= 0) {
+                        hw_in_use = 1;
+                        break;
                 }
+        }
 
-                coef_ret = cs_8409_vendor_coef_get(codec, coef_idx);
-
-                //if (coef_ret == -1) error;
-
-                coef_idx++;
-
-        } while (coef_idx <= 0x57);
+        if (in_use >= 0 && in_use != hw_in_use)
+                codec_err(codec, "cs8409 tdmInUse tracked %d scanned %d\n", in_use, hw_in_use);
 
-	dev_info(hda_codec_dev(codec), "command tdmInUse 0 end %d\n", where_flag);
+	dev_info(hda_codec_dev(codec), "command tdmInUse %d end %d\n", hw_in_use, where_flag);
 
-        return 0;
+        return hw_in_use;
 
 }
 
@@ -41,8 +47,6 @@ static int tdm_in_use(struct hda_codec *codec, int where_flag)
 static void init_for_node_vendor(struct hda_codec *codec)
 {
 	//int retval;
-        int coef_idx = 0x1a;
-        //int coef_ret = 0;
 
 	// this is AppleHDAFunctionGroupCS8409::initForNodeID
 
@@ -63,20 +67,8 @@ static void init_for_node_vendor(struct hda_codec *codec)
         snd_hda_coef_item(codec, 1, CS8409_VENDOR_NID, 0x0018, 0x0000, 0x00000000, 1391 ); //   coef write 1391
         snd_hda_coef_item(codec, 1, CS8409_VENDOR_NID, 0x0002, 0x0000, 0x00000000, 1395 ); //   coef write 1395
 
-        //coef_ret = cs_8409_vendor_coef_set(codec, 0x19, 0x8000);
-        cs_8409_vendor_coef_set(codec, 0x19, 0x8000);
-
-        //if (coef_ret == -1) error;
-
-        while (coef_idx <= 0x57)
-        {
-                //coef_ret = cs_8409_vendor_coef_set(codec, coef_idx, 0x8000);
-                cs_8409_vendor_coef_set(codec, coef_idx, 0x8000);
-
-                //if (coef_ret == -1) error;
-
-                coef_idx++;
-	}
+        // mark all TDM slots 0x19-0x57 unused - one auto increment burst
+        cs_8409_vendor_coef_fill_range(codec, CS8409_TDM_SLOT_FIRST, CS8409_TDM_SLOTS, 0x8000);
 
         // 0x82 0x0000 ASP1/2_xxx_EN = 0, DMIC1/2_SCL_EN = 0
         // others not documented cs4208_38.inf
@@ -303,25 +295,24 @@ static void setup_amps_reset_i2c_max(struct hda_codec *codec)
         // which is supposedly similar to the actual MAX98706
         // all analysis of the i2cWrite data is based on the MAX98372 data sheet
 
-        setup_gpio_set_20(codec);
-
 //      snd_hda i2cWrite      i2c address 0x64 i2c            reg 0x5101 i2c data 0x0001   reg anal: SoftwareReset           : Reset
-        cs_8409_vendor_i2cWrite(codec, 0x64, 0x0051, 0x0001, 0); // snd_hda
-
-        setup_gpio_set_20(codec);
-
 //      snd_hda i2cWrite      i2c address 0x62 i2c            reg 0x5101 i2c data 0x0001   reg anal: SoftwareReset           : Reset
-        cs_8409_vendor_i2cWrite(codec, 0x62, 0x0051, 0x0001, 0); // snd_hda
-
-        setup_gpio_set_20(codec);
-
 //      snd_hda i2cWrite      i2c address 0x74 i2c            reg 0x5101 i2c data 0x0001   reg anal: SoftwareReset           : Reset
-        cs_8409_vendor_i2cWrite(codec, 0x74, 0x0051, 0x0001, 0); // snd_hda
-
+//      snd_hda i2cWrite      i2c address 0x72 i2c            reg 0x5101 i2c data 0x0001   reg anal: SoftwareReset           : Reset
+        static const struct cs8409_i2c_op ops[] = {
+                { 0, 0x0051, 0x0001, 1, 0 },
+        };
+        int status[ARRAY_SIZE(cs_8409_max98706_addresses)];
+
+        // Apple re-sends the same gpio setup before each amp reset
+        // the values never change so doing it once is enough to run
+        // all the resets as one i2c broadcast
         setup_gpio_set_20(codec);
 
-//      snd_hda i2cWrite      i2c address 0x72 i2c            reg 0x5101 i2c data 0x0001   reg anal: SoftwareReset           : Reset
-        cs_8409_vendor_i2cWrite(codec, 0x72, 0x0051, 0x0001, 0); // snd_hda
+        cs_8409_vendor_i2c_broadcast(codec, cs_8409_max98706_addresses, ARRAY_SIZE(cs_8409_max98706_addresses),
+                                     ops, ARRAY_SIZE(ops), status);
+
+        cs_8409_amps_mark_dirty(codec);
 
 }
 
@@ -517,7 +508,30 @@ static int cs_8409_boot_setup_real(struct hda_codec *codec)
 }
 
 
-static void play_setup_amp(struct hda_codec *codec, int amp_address, int amp_volume)
+// MAX98706 play setup register list - sent to each amp
+// and the 0x2d DigitalVolCtrl data is replaced by the requested volume
+static const struct cs8409_i2c_op max98706_play_setup[] = {
+        { 0, 0x001c, 0x0001, 1, 0 },
+        { 0, 0x0010, 0x0008, 1, 0 },
+        { 0, 0x0014, 0x00e4, 1, 0 },
+        { 0, 0x0015, 0x0001, 1, 0 },
+        { 0, 0x0016, 0x0000, 1, 0 },
+        { 0, 0x0018, 0x0000, 1, 0 },
+        { 0, 0x0019, 0x0000, 1, 0 },
+        { 0, 0x002d, 0x0001, 1, 0 },
+        { 0, 0x002e, 0x0005, 1, 0 },
+        { 0, 0x004a, 0x0021, 1, 0 },
+        { 0, 0x004d, 0x0007, 1, 0 },
+        { 0, 0x0055, 0x0034, 1, 0 },
+        { 0, 0x0011, 0x0000, 0, 0 },
+        { 0, 0x0011, 0x0007, 1, 0 },
+        { 0, 0x0009, 0x003f, 1, 0 },
+        { 0, 0x000a, 0x007f, 1, 0 },
+        { 0, 0x000f, 0x000e, 1, 0 },
+        { 0, 0x0050, 0x0001, 1, 0 },
+};
+
+static int play_setup_amp(struct hda_codec *codec, const unsigned int *amp_addresses, int num_amps, int amp_volume)
 {
         //int retval;
 
@@ -546,25 +560,27 @@ static void play_setup_amp(struct hda_codec *codec, int amp_address, int amp_vol
 //      snd_hda i2cWrite      i2c address 0x64 i2c            reg 0x0f0e i2c data 0x000e   reg anal: IRQClear1
 //      snd_hda i2cWrite      i2c address 0x64 i2c            reg 0x5001 i2c data 0x0001   reg anal: GlobalEnable            : Enable
 
-        cs_8409_vendor_i2cWrite(codec, amp_address, 0x001c, 0x0001, 0); // snd_hda
-        cs_8409_vendor_i2cWrite(codec, amp_address, 0x0010, 0x0008, 0); // snd_hda
-        cs_8409_vendor_i2cWrite(codec, amp_address, 0x0014, 0x00e4, 0); // snd_hda
-        cs_8409_vendor_i2cWrite(codec, amp_address, 0x0015, 0x0001, 0); // snd_hda
-        cs_8409_vendor_i2cWrite(codec, amp_address, 0x0016, 0x0000, 0); // snd_hda
-        cs_8409_vendor_i2cWrite(codec, amp_address, 0x0018, 0x0000, 0); // snd_hda
-        cs_8409_vendor_i2cWrite(codec, amp_address, 0x0019, 0x0000, 0); // snd_hda
-        cs_8409_vendor_i2cWrite(codec, amp_address, 0x002d, amp_volume, 0); // snd_hda
-        cs_8409_vendor_i2cWrite(codec, amp_address, 0x002e, 0x0005, 0); // snd_hda
-        cs_8409_vendor_i2cWrite(codec, amp_address, 0x004a, 0x0021, 0); // snd_hda
-        cs_8409_vendor_i2cWrite(codec, amp_address, 0x004d, 0x0007, 0); // snd_hda
-        cs_8409_vendor_i2cWrite(codec, amp_address, 0x0055, 0x0034, 0); // snd_hda
-        cs_8409_vendor_i2cRead(codec, amp_address, 0x0011, 0); // snd_hda
-        cs_8409_vendor_i2cWrite(codec, amp_address, 0x0011, 0x0007, 0); // snd_hda
-        cs_8409_vendor_i2cWrite(codec, amp_address, 0x0009, 0x003f, 0); // snd_hda
-        cs_8409_vendor_i2cWrite(codec, amp_address, 0x000a, 0x007f, 0); // snd_hda
-        cs_8409_vendor_i2cWrite(codec, amp_address, 0x000f, 0x000e, 0); // snd_hda
-        cs_8409_vendor_i2cWrite(codec, amp_address, 0x0050, 0x0001, 0); // snd_hda
+        struct cs8409_i2c_op ops[ARRAY_SIZE(max98706_play_setup)];
+        int status[4];
+        int err;
+        int i;
+
+        for (i = 0; i < ARRAY_SIZE(max98706_play_setup); i++) {
+                ops[i] = max98706_play_setup[i];
+                if (ops[i].write && ops[i].reg == 0x002d)
+                        ops[i].data = amp_volume;
+        }
+
+        if (WARN_ON(num_amps > ARRAY_SIZE(status)))
+                return -EINVAL;
 
+        err = cs_8409_amp_regmap_broadcast(codec, amp_addresses, num_amps, ops, ARRAY_SIZE(ops), 1, status);
+
+        for (i = 0; i < num_amps; i++)
+                if (status[i])
+                        codec_err(codec, "amp 0x%02x play setup failed %d\n", amp_addresses[i], status[i]);
+
+        return err;
 }
 
 
@@ -628,11 +644,9 @@ static void play_setup_TDM_amps12(struct hda_codec *codec, int setrate)
 
         // this seems to be setup for node 0x02 chain - which seems to use node 0x24 and amps 0x64 and 0x62 (or 0x28 0x2a)
 
-        snd_hda_codec_write(codec, 0x02, 0, AC_VERB_SET_STREAM_FORMAT, 0x00004033); // 0x00224033
-//      snd_hda:     stream format 2 [('CHAN', 4), ('RATE', 44100), ('BITS', 24), ('RATE_MUL', 1), ('RATE_DIV', 1)]
-
-        snd_hda_codec_write(codec, 0x02, 0, AC_VERB_SET_CHANNEL_STREAMID, 0x00000010); // 0x00270610
-//      snd_hda:     conv stream channel map 2 [('CHAN', 0), ('STREAMID', 1)]
+        // OSX writes the node 0x02 format (0x4033) and stream id (0x10) here
+        // we leave that to snd_hda_multi_out_analog_prepare which writes the
+        // real stream format and tag once - see play_sync_converters_on
 
         if (setrate)
                 play_setup_TDM_sample_rate(codec);
@@ -650,24 +664,23 @@ static void play_setup_TDM_amps12(struct hda_codec *codec, int setrate)
 
 }
 
-static void play_setup_amp_ssm3(struct hda_codec *codec, int amp_address, int amp_volume);
+static int play_setup_amp_ssm3(struct hda_codec *codec, const unsigned int *amp_addresses, int num_amps, int amp_volume);
 
-static void play_setup_amps12(struct hda_codec *codec)
+static int play_setup_amps12(struct hda_codec *codec)
 {
         if (codec->core.subsystem_id == 0x106b3900) {
 		// use reduced volume - from 0x01 to 0x30 - now passing as argument
-                play_setup_amp(codec, 0x64, 0x30);
-                play_setup_amp(codec, 0x62, 0x30);
+                return play_setup_amp(codec, &cs_8409_max98706_addresses[0], 2, 0x30);
         }
         else if (codec->core.subsystem_id == 0x106b3300) {
                 //setup_node_alpha_ssm3(codec);
 		// use reduced volume - from 0x48 to 0x80 - same reduction as for MAXs -24dB
-                play_setup_amp_ssm3(codec, 0x28, 0x80);
-                play_setup_amp_ssm3(codec, 0x2a, 0x80);
+                return play_setup_amp_ssm3(codec, &cs_8409_ssm3515_addresses[0], 2, 0x80);
         }
         else {
                 printk("snd_hda_intel: UNKNOWN subsystem id 0x%08x",codec->core.subsystem_id);
         }
+        return -ENODEV;
 }
 
 
@@ -701,11 +714,8 @@ static void play_setup_TDM_amps34(struct hda_codec *codec)
 
         // this seems to be setup for node 0x03 chain - which seems to use node 0x25 and amps 0x74 and 0x72 (or 0x2c and 0x2e)
 
-        snd_hda_codec_write(codec, 0x03, 0, AC_VERB_SET_STREAM_FORMAT, 0x00004033); // 0x00324033
-//      snd_hda:     stream format 3 [('CHAN', 4), ('RATE', 44100), ('BITS', 24), ('RATE_MUL', 1), ('RATE_DIV', 1)]
-
-        snd_hda_codec_write(codec, 0x03, 0, AC_VERB_SET_CHANNEL_STREAMID, 0x00000012); // 0x00370612
-//      snd_hda:     conv stream channel map 3 [('CHAN', 2), ('STREAMID', 1)]
+        // as for node 0x02 the format (0x4033) and stream id (0x12) are left
+        // to snd_hda_multi_out_analog_prepare
 
 
         play_setup_TDM_proper_amps34(codec);
@@ -721,27 +731,28 @@ static void play_setup_TDM_amps34(struct hda_codec *codec)
 }
 
 
-static void play_setup_amps34(struct hda_codec *codec)
+static int play_setup_amps34(struct hda_codec *codec)
 {
         if (codec->core.subsystem_id == 0x106b3900) {
 		// use reduced volume - from 0x01 to 0x30 - now passing as argument
-                play_setup_amp(codec, 0x74, 0x30);
-                play_setup_amp(codec, 0x72, 0x30);
+                return play_setup_amp(codec, &cs_8409_max98706_addresses[2], 2, 0x30);
         }
         else if (codec->core.subsystem_id == 0x106b3300) {
                 //setup_node_alpha_ssm3(codec);
 		// use reduced volume - from 0x48 to 0x80 - same reduction as for MAXs -24dB
-                play_setup_amp_ssm3(codec, 0x2c, 0x80);
-                play_setup_amp_ssm3(codec, 0x2e, 0x80);
+                return play_setup_amp_ssm3(codec, &cs_8409_ssm3515_addresses[2], 2, 0x80);
         }
         else {
                 printk("snd_hda_intel: UNKNOWN subsystem id 0x%08x",codec->core.subsystem_id);
         }
+        return -ENODEV;
 }
 
+static void cs_8409_play_cvt_stop(struct hda_codec *codec, hda_nid_t nid);
+
 static void play_sync_converters_on(struct hda_codec *codec)
 {
-        int retval;
+        unsigned int old_coef, new_coef;
 
         // this stops streaming on nodes 0x2 and 0x3 by switching to stream index 0
         // then updates vendor node coef index 0x0017 twice
@@ -751,51 +762,46 @@ static void play_sync_converters_on(struct hda_codec *codec)
 
         // so coef index 0x17 is likely turning on the TDM stream
 
+        // the stream index 0 is done through the hda core so its converter
+        // cache (cvt_setups) stays in step - it only writes what is not
+        // already 0 and the following snd_hda_multi_out_analog_prepare then
+        // writes the final format and stream tag in one go
+        // (OSX restores its own stream ids 0x10/0x12 here)
+        // from the pre-warm worker see cs_8409_play_cvt_stop
+
         snd_hda_codec_write(codec, CS8409_VENDOR_NID, 0, AC_VERB_SET_PROC_STATE, 0x00000001); // 0x04770301
 
         // remove normal channel mapping
 
 //      snd_hda: # AppleHDAFunctionGroupCS8409::syncConverters:
-        //retval = snd_hda_codec_read_check(codec, 0x02, 0, AC_VERB_GET_CONV, 0x00000000, 0x00000010, 2714); // 0x002f0600
-        retval = snd_hda_codec_read(codec, 0x02, 0, AC_VERB_GET_CONV, 0x00000000); // 0x002f0600
-//      snd_hda:     conv stream channel map 2 [('CHAN', 0), ('STREAMID', 1)]
-
-        snd_hda_codec_write(codec, 0x02, 0, AC_VERB_SET_CHANNEL_STREAMID, 0x00000000); // 0x00270600
+        cs_8409_play_cvt_stop(codec, 0x02); // 0x00270600
 //      snd_hda:     conv stream channel map 2 [('CHAN', 0), ('STREAMID', 0)]
 
 
-        snd_hda_coef_item(codec, 2, CS8409_VENDOR_NID, 0x0017, 0x0001, 0x00000000, 2716 ); // coef write mask 2716
+        // converter 0x02 is bit 0 of coef 0x17 - leave the other converter alone
+        cs_8409_vendor_coef_update(codec, 0x0017, 0x0001, 0x0001, &old_coef, &new_coef); // coef write mask 2716
+        codec_dbg(codec, "coef 0x17 0x%04x -> 0x%04x\n", old_coef, new_coef);
 //      snd_hda_coef_item_masked(codec, 2, CS8409_VENDOR_NID, 0x0017, 0x0001, 0xundef, 0x00000000, 2716 ); // coef write mask 2716
 
 
 //      snd_hda: # AppleHDAFunctionGroupCS8409::syncConverters:
-        //retval = snd_hda_codec_read_check(codec, 0x03, 0, AC_VERB_GET_CONV, 0x00000000, 0x00000012, 2722); // 0x003f0600
-        retval = snd_hda_codec_read(codec, 0x03, 0, AC_VERB_GET_CONV, 0x00000000); // 0x003f0600
-//      snd_hda:     conv stream channel map 3 [('CHAN', 2), ('STREAMID', 1)]
-
-        snd_hda_codec_write(codec, 0x03, 0, AC_VERB_SET_CHANNEL_STREAMID, 0x00000000); // 0x00370600
+        cs_8409_play_cvt_stop(codec, 0x03); // 0x00370600
 //      snd_hda:     conv stream channel map 3 [('CHAN', 0), ('STREAMID', 0)]
 
 
-        snd_hda_coef_item(codec, 2, CS8409_VENDOR_NID, 0x0017, 0x0003, 0x00000001, 2724 ); // coef write mask 2724
+        // converter 0x03 is bit 1 of coef 0x17
+        cs_8409_vendor_coef_update(codec, 0x0017, 0x0002, 0x0002, &old_coef, &new_coef); // coef write mask 2724
+        codec_dbg(codec, "coef 0x17 0x%04x -> 0x%04x\n", old_coef, new_coef);
 //      snd_hda_coef_item_masked(codec, 2, CS8409_VENDOR_NID, 0x0017, 0x0003, 0xundef, 0x00000001, 2724 ); // coef write mask 2724
 
-
-        // and reset back to normal channel mapping
-
-        snd_hda_codec_write(codec, 0x02, 0, AC_VERB_SET_CHANNEL_STREAMID, 0x00000010); // 0x00270610
-//      snd_hda:     conv stream channel map 2 [('CHAN', 0), ('STREAMID', 1)]
-
-        snd_hda_codec_write(codec, 0x03, 0, AC_VERB_SET_CHANNEL_STREAMID, 0x00000012); // 0x00370612
-//      snd_hda:     conv stream channel map 3 [('CHAN', 2), ('STREAMID', 1)]
-
-
 }
 
 
-static void cs_8409_play_real(struct hda_codec *codec)
+static int cs_8409_play_real(struct hda_codec *codec)
 {
         int retval;
+        int err;
+        int err34;
         //struct cs_spec *spec = codec->spec;
 
         //cs_8409_play_data(codec);
@@ -810,23 +816,45 @@ static void cs_8409_play_real(struct hda_codec *codec)
 
         play_setup_TDM_amps12(codec, 1);
 
-        play_setup_amps12(codec);
+        err = play_setup_amps12(codec);
 
 
         play_setup_TDM_amps34(codec);
 
-        play_setup_amps34(codec);
+        err34 = play_setup_amps34(codec);
 
 
         play_sync_converters_on(codec);
 
         printk("snd_hda_intel: command nid cs_8409_play_real end");
 
+        return err < 0 ? err : err34;
+}
+
+// MAX98706 InterruptState0/InterruptState1/State1
+static const unsigned int max98706_status_regs[] = { 0x03, 0x04, 0x0c };
+
+// read and log the amp status in the background after a stop
+// one burst read per amp
+static void playstop_amp_status_done(struct hda_codec *codec, struct cs8409_i2c_op *ops, int nops, int status, void *data)
+{
+        unsigned int amp_address = (uintptr_t)data;
+        unsigned int vals[ARRAY_SIZE(max98706_status_regs)];
+        int err;
+
+        err = cs_8409_vendor_i2c_read_regs(codec, amp_address, max98706_status_regs, 0, vals,
+                                           ARRAY_SIZE(max98706_status_regs), 0);
+
+        codec_dbg(codec, "amp 0x%02x status 0x%02x 0x%02x 0x%02x err %d\n",
+                  amp_address, vals[0], vals[1], vals[2], err);
 }
 
 static void playstop_disable_amp(struct hda_codec *codec, int amp_address)
 {
         //int retval;
+        struct cs8409_i2c_op ops[] = {
+                { amp_address, 0x0050, 0x0000, 1, 0 },
+        };
 
         // interrupt read/state read new as of June 2019
 
@@ -836,16 +864,17 @@ static void playstop_disable_amp(struct hda_codec *codec, int amp_address)
 //      snd_hda i2cRead       i2c address 0x64 i2c            reg 0x0400 i2c data 0x0400   reg anal: InterruptState1
 //      snd_hda i2cRead       i2c address 0x64 i2c            reg 0x0c00 i2c data 0x0c00   reg anal: State1
 
-        cs_8409_vendor_i2cWrite(codec, amp_address, 0x0050, 0x0000, 0); // snd_hda
-        cs_8409_vendor_i2cRead(codec, amp_address, 0x0003, 0); // snd_hda
-        cs_8409_vendor_i2cRead(codec, amp_address, 0x0004, 0); // snd_hda
-        cs_8409_vendor_i2cRead(codec, amp_address, 0x000c, 0); // snd_hda
+        // the disable has to reach the amp before the TDM path goes down
+        cs_8409_amp_regmap_sequence(codec, amp_address, ops, ARRAY_SIZE(ops), 0);
+
+        // nothing waits on the status reads so leave them to the i2c queue
+        cs_8409_i2c_queue(codec, NULL, 0, playstop_amp_status_done, (void *)(uintptr_t)amp_address, 0);
 
 }
 
 static void playstop_sync_converters_off(struct hda_codec *codec)
 {
-        int retval;
+        unsigned int old_coef, new_coef;
 
         // this stops streaming on nodes 0x2 and 0x3 by switching to stream index 0
         // then updates vendor node coef index 0x0017 twice
@@ -855,30 +884,28 @@ static void playstop_sync_converters_off(struct hda_codec *codec)
 
         // so coef index 0x17 is likely turning off the TDM stream
 
+        // as for play_sync_converters_on the stream index 0 goes through the
+        // hda core cache - and the converters are left cleaned up (stream 0
+        // format 0) rather than restored as the TDM disable clears them anyway
+
         snd_hda_codec_write(codec, CS8409_VENDOR_NID, 0, AC_VERB_SET_PROC_STATE, 0x00000001); // 0x04770301
 
         // remove normal channel mapping
 
 //      snd_hda: # AppleHDAFunctionGroupCS8409::syncConverters:
-        //retval = snd_hda_codec_read_check(codec, 0x02, 0, AC_VERB_GET_CONV, 0x00000000, 0x00000010, 4); // 0x002f0600
-        retval = snd_hda_codec_read(codec, 0x02, 0, AC_VERB_GET_CONV, 0x00000000); // 0x002f0600
-//      snd_hda:     conv stream channel map 2 [('CHAN', 0), ('STREAMID', 1)]
-
-        snd_hda_codec_write(codec, 0x02, 0, AC_VERB_SET_CHANNEL_STREAMID, 0x00000000); // 0x00270600
+        cs_8409_play_cvt_stop(codec, 0x02); // 0x00270600
 //      snd_hda:     conv stream channel map 2 [('CHAN', 0), ('STREAMID', 0)]
 
-        snd_hda_coef_item(codec, 2, CS8409_VENDOR_NID, 0x0017, 0x0002, 0x00000003, 6 ); // coef write mask 6
+        cs_8409_vendor_coef_update(codec, 0x0017, 0x0000, 0x0001, &old_coef, &new_coef); // coef write mask 6
+        codec_dbg(codec, "coef 0x17 0x%04x -> 0x%04x\n", old_coef, new_coef);
 //      snd_hda_coef_item_masked(codec, 2, CS8409_VENDOR_NID, 0x0017, 0x0002, 0xundef, 0x00000003, 6 ); // coef write mask 6
 
 //      snd_hda: # AppleHDAFunctionGroupCS8409::syncConverters:
-        //retval = snd_hda_codec_read_check(codec, 0x03, 0, AC_VERB_GET_CONV, 0x00000000, 0x00000012, 12); // 0x003f0600
-        retval = snd_hda_codec_read(codec, 0x03, 0, AC_VERB_GET_CONV, 0x00000000); // 0x003f0600
-//      snd_hda:     conv stream channel map 3 [('CHAN', 2), ('STREAMID', 1)]
-
-        snd_hda_codec_write(codec, 0x03, 0, AC_VERB_SET_CHANNEL_STREAMID, 0x00000000); // 0x00370600
+        cs_8409_play_cvt_stop(codec, 0x03); // 0x00370600
 //      snd_hda:     conv stream channel map 3 [('CHAN', 0), ('STREAMID', 0)]
 
-        snd_hda_coef_item(codec, 2, CS8409_VENDOR_NID, 0x0017, 0x0000, 0x00000002, 14 ); // coef write mask 14
+        cs_8409_vendor_coef_update(codec, 0x0017, 0x0000, 0x0002, &old_coef, &new_coef); // coef write mask 14
+        codec_dbg(codec, "coef 0x17 0x%04x -> 0x%04x\n", old_coef, new_coef);
 //      snd_hda_coef_item_masked(codec, 2, CS8409_VENDOR_NID, 0x0017, 0x0000, 0xundef, 0x00000002, 14 ); // coef write mask 14
 
         snd_hda_coef_item(codec, 0, CS8409_VENDOR_NID, 0x0017, 0x0000, 0x00000000, 20 ); //   coef read 20
@@ -887,14 +914,6 @@ static void playstop_sync_converters_off(struct hda_codec *codec)
         snd_hda_coef_item(codec, 2, CS8409_VENDOR_NID, 0x0001, 0x0220, 0x00000220, 28 ); // coef write mask 28
 //      snd_hda_coef_item_masked(codec, 2, CS8409_VENDOR_NID, 0x0001, 0x0220, 0xundef, 0x00000220, 28 ); // coef write mask 28
 
-        // and reset back to normal channel mapping
-
-        snd_hda_codec_write(codec, 0x02, 0, AC_VERB_SET_CHANNEL_STREAMID, 0x00000010); // 0x00270610
-//      snd_hda:     conv stream channel map 2 [('CHAN', 0), ('STREAMID', 1)]
-
-        snd_hda_codec_write(codec, 0x03, 0, AC_VERB_SET_CHANNEL_STREAMID, 0x00000012); // 0x00370612
-//      snd_hda:     conv stream channel map 3 [('CHAN', 2), ('STREAMID', 1)]
-
 }
 
 
@@ -952,12 +971,7 @@ static void playstop_disable_TDM_amps12(struct hda_codec *codec)
 
 
         // set to defaults and disable output
-
-        snd_hda_codec_write(codec, 0x02, 0, AC_VERB_SET_CHANNEL_STREAMID, 0x00000000); // 0x00270600
-//      snd_hda:     conv stream channel map 2 [('CHAN', 0), ('STREAMID', 0)]
-
-        snd_hda_codec_write(codec, 0x02, 0, AC_VERB_SET_STREAM_FORMAT, 0x00000000); // 0x00220000
-//      snd_hda:     stream format 2 [('CHAN', 1), ('RATE', 48000), ('BITS', 8), ('RATE_MUL', 1), ('RATE_DIV', 1)]
+        // (node 0x02 stream id and format already cleared by playstop_sync_converters_off)
 
         //retval = snd_hda_codec_read_check(codec, 0x24, 0, AC_VERB_GET_PIN_WIDGET_CONTROL, 0x00000000, 0x00000040, 387); // 0x024f0700
         retval = snd_hda_codec_read(codec, 0x24, 0, AC_VERB_GET_PIN_WIDGET_CONTROL, 0x00000000); // 0x024f0700
@@ -1029,12 +1043,7 @@ static void playstop_disable_TDM_amps34(struct hda_codec *codec)
 
 
         // set to defaults and disable output
-
-        snd_hda_codec_write(codec, 0x03, 0, AC_VERB_SET_CHANNEL_STREAMID, 0x00000000); // 0x00370600
-//      snd_hda:     conv stream channel map 3 [('CHAN', 0), ('STREAMID', 0)]
-
-        snd_hda_codec_write(codec, 0x03, 0, AC_VERB_SET_STREAM_FORMAT, 0x00000000); // 0x00320000
-//      snd_hda:     stream format 3 [('CHAN', 1), ('RATE', 48000), ('BITS', 8), ('RATE_MUL', 1), ('RATE_DIV', 1)]
+        // (node 0x03 stream id and format already cleared by playstop_sync_converters_off)
 
         //retval = snd_hda_codec_read_check(codec, 0x25, 0, AC_VERB_GET_PIN_WIDGET_CONTROL, 0x00000000, 0x00000040, 986); // 0x025f0700
         retval = snd_hda_codec_read(codec, 0x25, 0, AC_VERB_GET_PIN_WIDGET_CONTROL, 0x00000000); // 0x025f0700
@@ -1044,6 +1053,30 @@ static void playstop_disable_TDM_amps34(struct hda_codec *codec)
 }
 
 
+static void playstop_afg_d3_done(struct hda_codec *codec, struct cs8409_i2c_op *ops, int nops, int status, void *data)
+{
+        //snd_hda_codec_write(codec, codec->core.afg, 0, AC_VERB_SET_POWER_STATE, 0x00000003); // 0x00170503
+        hda_set_node_power_state(codec, codec->core.afg, AC_PWRST_D3);
+}
+
+static int cs_8409_amps_enable(struct hda_codec *codec, int enable);
+
+// the repeated disable goes through the amp regmaps as the first one did
+// (and the page/register caches stay right for the SSM3515 PowerControl)
+static void playstop_amps_disable_done(struct hda_codec *codec, struct cs8409_i2c_op *ops, int nops, int status, void *data)
+{
+        cs_8409_amps_enable(codec, 0);
+}
+
+// the repeated amp disable then AFG D3 at the end of a stop - in the background
+static void playstop_queue_amps_disable(struct hda_codec *codec)
+{
+        cs_8409_i2c_queue(codec, NULL, 0, playstop_amps_disable_done, NULL, 0);
+
+        cs_8409_i2c_queue(codec, NULL, 0, playstop_afg_d3_done, NULL, 0);
+}
+
+
 static void cs_8409_playstop_real(struct hda_codec *codec)
 {
         //int retval;
@@ -1064,14 +1097,10 @@ static void cs_8409_playstop_real(struct hda_codec *codec)
         playstop_disable_TDM_amps34(codec);
 
         // for some reason Apple duplicates the amp disable here??
+        // the amps are already disabled so queue the repeat and the AFG
+        // power down rather than holding up the stop
 
-        playstop_disable_amps12(codec);
-
-        playstop_disable_amps34(codec);
-
-
-        //snd_hda_codec_write(codec, codec->core.afg, 0, AC_VERB_SET_POWER_STATE, 0x00000003); // 0x00170503
-        hda_set_node_power_state(codec, codec->core.afg, AC_PWRST_D3);
+        playstop_queue_amps_disable(codec);
 
         //retval = snd_hda_codec_read_check(codec, 0x22, 0, AC_VERB_GET_POWER_STATE, 0x00000000, 0x00000033, 1636); // 0x022f0500
         //retval = snd_hda_codec_read_check(codec, 0x23, 0, AC_VERB_GET_POWER_STATE, 0x00000000, 0x00000033, 1637); // 0x023f0500
@@ -0,0 +1,1093 @@
+/*
+ * cs8409_seqopt - offline optimizer for the replayed CS8409 sequences
+ *
+ * The data headers (patch_cirrus_data84.h, patch_cirrus_mb141_data84.h) are
+ * a straight replay of the OSX log - every sanity read, every duplicate
+ * GPIO/coef write and every i2c transaction spelled out as coef 0x59-0x5e
+ * accesses. This reads a sequence from such a header (a struct hda_coef
+ * table, or a function which is expanded through the tables, inline calls
+ * and other functions it calls) and
+ *
+ *   - folds the raw coef 0x59/0x5c/0x5d/0x5e i2c sub-transactions back into
+ *     CS8409_SEQ_I2C_WRITE/CS8409_SEQ_I2C_READ ops
+ *   - drops pure verification reads (coef reads, GET verbs) - a "read" of a
+ *     SET verb still does the set so becomes a plain verb write, a write mask
+ *     becomes the write (the driver writes all bits of a logged write mask)
+ *   - drops writes of a value the coef/verb already holds from an earlier
+ *     write in the sequence (-r also trusts the logged read values)
+ *
+ * The result is emitted as a struct hda_coef table (or a version 1
+ * cs8409-<subsystem id>.bin firmware section, see patch_cirrus_new84.h)
+ * with a report of ops and estimated HDA verbs saved.
+ * -c replays both sequences through a register model and checks the final
+ * coef, verb and i2c register state is the same.
+ *
+ * i2c reads are kept - the amp interrupt state registers clear on read.
+ *
+ * build: cc -O2 -Wall -o cs8409_seqopt cs8409_seqopt.c
+ * usage: cs8409_seqopt [-r] [-c] [-o table.h] [-b out.bin -t boot|play|playstop -i subsystem_id]
+ *                      header.h name
+ * eg:    cs8409_seqopt -c patch_cirrus_data84.h cs_8409_boot_setup_data
+ */
+
+#include <ctype.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+/* struct hda_coef ops - keep in step with patch_cirrus_new84.h */
+#define SEQ_COEF_READ	0
+#define SEQ_COEF_WRITE	1
+#define SEQ_COEF_MASK	2
+#define SEQ_VERB	3
+#define SEQ_VERB_CHECK	4
+#define SEQ_POWER	5
+#define SEQ_I2C_WRITE	6
+#define SEQ_I2C_READ	7
+#define SEQ_DELAY	8
+#define SEQ_NOPS	9
+
+#define SEQ_AFG		0xff
+#define VENDOR_NID	0x47
+
+#define FW_MAGIC	0x39385343	/* "CS89" */
+#define FW_VERSION	1
+
+struct op {
+	int op;
+	int nid;
+	unsigned int idx;
+	unsigned int param;
+	unsigned int retdata;
+	unsigned int srcidx;
+};
+
+struct seq {
+	struct op *ops;
+	int n;
+	int alloc;
+};
+
+static void seq_add(struct seq *s, const struct op *o)
+{
+	if (s->n == s->alloc) {
+		s->alloc = s->alloc ? s->alloc * 2 : 256;
+		s->ops = realloc(s->ops, s->alloc * sizeof(*s->ops));
+		if (!s->ops) {
+			perror("realloc");
+			exit(1);
+		}
+	}
+	s->ops[s->n++] = *o;
+}
+
+struct sym {
+	const char *name;
+	unsigned int val;
+};
+
+static const struct sym syms[] = {
+	{ "CS8409_VENDOR_NID", VENDOR_NID },
+	{ "CS8409_SEQ_AFG", SEQ_AFG },
+	{ "codec->core.afg", SEQ_AFG },
+	{ "CS8409_SEQ_COEF_READ", SEQ_COEF_READ },
+	{ "CS8409_SEQ_COEF_WRITE", SEQ_COEF_WRITE },
+	{ "CS8409_SEQ_COEF_MASK", SEQ_COEF_MASK },
+	{ "CS8409_SEQ_VERB", SEQ_VERB },
+	{ "CS8409_SEQ_VERB_CHECK", SEQ_VERB_CHECK },
+	{ "CS8409_SEQ_POWER", SEQ_POWER },
+	{ "CS8409_SEQ_I2C_WRITE", SEQ_I2C_WRITE },
+	{ "CS8409_SEQ_I2C_READ", SEQ_I2C_READ },
+	{ "CS8409_SEQ_DELAY", SEQ_DELAY },
+	{ "AC_PWRST_D0", 0 },
+	{ "AC_PWRST_D1", 1 },
+	{ "AC_PWRST_D2", 2 },
+	{ "AC_PWRST_D3", 3 },
+};
+
+/* the hda_verbs.h verbs used by the sequences */
+static const struct sym verbs[] = {
+	{ "AC_VERB_GET_STREAM_FORMAT", 0x0a00 },
+	{ "AC_VERB_GET_AMP_GAIN_MUTE", 0x0b00 },
+	{ "AC_VERB_GET_PROC_COEF", 0x0c00 },
+	{ "AC_VERB_GET_COEF_INDEX", 0x0d00 },
+	{ "AC_VERB_PARAMETERS", 0x0f00 },
+	{ "AC_VERB_GET_CONNECT_SEL", 0x0f01 },
+	{ "AC_VERB_GET_CONNECT_LIST", 0x0f02 },
+	{ "AC_VERB_GET_PROC_STATE", 0x0f03 },
+	{ "AC_VERB_GET_SDI_SELECT", 0x0f04 },
+	{ "AC_VERB_GET_POWER_STATE", 0x0f05 },
+	{ "AC_VERB_GET_CONV", 0x0f06 },
+	{ "AC_VERB_GET_PIN_WIDGET_CONTROL", 0x0f07 },
+	{ "AC_VERB_GET_UNSOLICITED_RESPONSE", 0x0f08 },
+	{ "AC_VERB_GET_PIN_SENSE", 0x0f09 },
+	{ "AC_VERB_GET_BEEP_CONTROL", 0x0f0a },
+	{ "AC_VERB_GET_EAPD_BTLENABLE", 0x0f0c },
+	{ "AC_VERB_GET_DIGI_CONVERT_1", 0x0f0d },
+	{ "AC_VERB_GET_DIGI_CONVERT_2", 0x0f0e },
+	{ "AC_VERB_GET_VOLUME_KNOB_CONTROL", 0x0f0f },
+	{ "AC_VERB_GET_GPIO_DATA", 0x0f15 },
+	{ "AC_VERB_GET_GPIO_MASK", 0x0f16 },
+	{ "AC_VERB_GET_GPIO_DIRECTION", 0x0f17 },
+	{ "AC_VERB_GET_GPIO_WAKE_MASK", 0x0f18 },
+	{ "AC_VERB_GET_GPIO_UNSOLICITED_RSP_MASK", 0x0f19 },
+	{ "AC_VERB_GET_GPIO_STICKY_MASK", 0x0f1a },
+	{ "AC_VERB_GET_CONFIG_DEFAULT", 0x0f1c },
+	{ "AC_VERB_GET_SUBSYSTEM_ID", 0x0f20 },
+	{ "AC_VERB_GET_CVT_CHAN_COUNT", 0x0f2d },
+	{ "AC_VERB_SET_STREAM_FORMAT", 0x200 },
+	{ "AC_VERB_SET_AMP_GAIN_MUTE", 0x300 },
+	{ "AC_VERB_SET_PROC_COEF", 0x400 },
+	{ "AC_VERB_SET_COEF_INDEX", 0x500 },
+	{ "AC_VERB_SET_CONNECT_SEL", 0x701 },
+	{ "AC_VERB_SET_PROC_STATE", 0x703 },
+	{ "AC_VERB_SET_SDI_SELECT", 0x704 },
+	{ "AC_VERB_SET_POWER_STATE", 0x705 },
+	{ "AC_VERB_SET_CHANNEL_STREAMID", 0x706 },
+	{ "AC_VERB_SET_PIN_WIDGET_CONTROL", 0x707 },
+	{ "AC_VERB_SET_UNSOLICITED_ENABLE", 0x708 },
+	{ "AC_VERB_SET_PIN_SENSE", 0x709 },
+	{ "AC_VERB_SET_BEEP_CONTROL", 0x70a },
+	{ "AC_VERB_SET_EAPD_BTLENABLE", 0x70c },
+	{ "AC_VERB_SET_DIGI_CONVERT_1", 0x70d },
+	{ "AC_VERB_SET_DIGI_CONVERT_2", 0x70e },
+	{ "AC_VERB_SET_VOLUME_KNOB_CONTROL", 0x70f },
+	{ "AC_VERB_SET_GPIO_DATA", 0x715 },
+	{ "AC_VERB_SET_GPIO_MASK", 0x716 },
+	{ "AC_VERB_SET_GPIO_DIRECTION", 0x717 },
+	{ "AC_VERB_SET_GPIO_WAKE_MASK", 0x718 },
+	{ "AC_VERB_SET_GPIO_UNSOLICITED_RSP_MASK", 0x719 },
+	{ "AC_VERB_SET_GPIO_STICKY_MASK", 0x71a },
+	{ "AC_VERB_SET_CONFIG_DEFAULT_BYTES_0", 0x71c },
+	{ "AC_VERB_SET_CONFIG_DEFAULT_BYTES_1", 0x71d },
+	{ "AC_VERB_SET_CONFIG_DEFAULT_BYTES_2", 0x71e },
+	{ "AC_VERB_SET_CONFIG_DEFAULT_BYTES_3", 0x71f },
+	{ "AC_VERB_SET_EAPD", 0x788 },
+	{ "AC_VERB_SET_CODEC_RESET", 0x7ff },
+	{ "AC_VERB_DBL_CODEC_RESET", 0xfff },
+};
+
+#define ARRAY_SIZE(a) (sizeof(a) / sizeof((a)[0]))
+
+static int sym_value(const char *tok, unsigned int *val)
+{
+	char *end;
+	size_t i;
+
+	if (isdigit((unsigned char)tok[0])) {
+		*val = strtoul(tok, &end, 0);
+		return *end ? -1 : 0;
+	}
+	for (i = 0; i < ARRAY_SIZE(syms); i++)
+		if (!strcmp(tok, syms[i].name)) {
+			*val = syms[i].val;
+			return 0;
+		}
+	for (i = 0; i < ARRAY_SIZE(verbs); i++)
+		if (!strcmp(tok, verbs[i].name)) {
+			*val = verbs[i].val;
+			return 0;
+		}
+	return -1;
+}
+
+static const char *verb_name(unsigned int verb)
+{
+	size_t i;
+
+	for (i = 0; i < ARRAY_SIZE(verbs); i++)
+		if (verbs[i].val == verb)
+			return verbs[i].name;
+	return NULL;
+}
+
+/* get verbs - 12 bit 0xf.. and the 4 bit 0xa-0xd ones */
+static int verb_is_get(unsigned int verb)
+{
+	return (verb & 0xf00) == 0xf00 || (verb >= 0xa00 && verb <= 0xd00);
+}
+
+/* get verbs with a side effect - the GPIO data read clears the GPIO interrupt status */
+static int verb_must_read(unsigned int verb)
+{
+	return verb == 0xf15;
+}
+
+/* set verbs that just latch a value - writing the same value again does nothing */
+static int verb_is_latch(unsigned int verb)
+{
+	switch (verb) {
+	case 0x200: case 0x300: case 0x701: case 0x703: case 0x704:
+	case 0x705: case 0x706: case 0x707: case 0x708: case 0x70a:
+	case 0x70c: case 0x70d: case 0x70e: case 0x70f: case 0x715:
+	case 0x716: case 0x717: case 0x718: case 0x719: case 0x71a:
+	case 0x71c: case 0x71d: case 0x71e: case 0x71f: case 0x788:
+		return 1;
+	}
+	return 0;
+}
+
+static int verb_is_reset(unsigned int verb)
+{
+	return verb == 0x7ff || verb == 0xfff;
+}
+
+/* the i2c engine coefs */
+static int coef_is_i2c(unsigned int idx)
+{
+	return idx >= 0x59 && idx <= 0x5e;
+}
+
+/*
+ * coefs that just hold the last value written (the driver shadows the same
+ * set) - the TDM slot table and the TDM bus setup 0x6b/0x71/0x82
+ * writes to the others (0x00 i2c clock, 0x17 converter sync..) act on the
+ * hardware so repeats are kept
+ */
+static int coef_is_latch(unsigned int idx)
+{
+	return (idx >= 0x19 && idx <= 0x57) || idx == 0x6b || idx == 0x71 || idx == 0x82;
+}
+
+/* ---- parsing ---- */
+
+enum { ITEM_OP, ITEM_TABLE, ITEM_CALL, ITEM_RESET };
+
+struct item {
+	int type;
+	struct op op;
+	char name[96];
+};
+
+struct block {
+	char name[96];
+	int is_table;
+	struct item *items;
+	int n, alloc;
+};
+
+static struct block *blocks;
+static int nblocks, ablocks;
+
+static struct block *block_new(const char *name, int is_table)
+{
+	struct block *b;
+
+	if (nblocks == ablocks) {
+		ablocks = ablocks ? ablocks * 2 : 64;
+		blocks = realloc(blocks, ablocks * sizeof(*blocks));
+		if (!blocks) {
+			perror("realloc");
+			exit(1);
+		}
+	}
+	b = &blocks[nblocks++];
+	memset(b, 0, sizeof(*b));
+	snprintf(b->name, sizeof(b->name), "%s", name);
+	b->is_table = is_table;
+	return b;
+}
+
+static void block_add(struct block *b, const struct item *it)
+{
+	if (b->n == b->alloc) {
+		b->alloc = b->alloc ? b->alloc * 2 : 64;
+		b->items = realloc(b->items, b->alloc * sizeof(*b->items));
+		if (!b->items) {
+			perror("realloc");
+			exit(1);
+		}
+	}
+	b->items[b->n++] = *it;
+}
+
+static struct block *block_find(const char *name)
+{
+	int i;
+
+	for (i = 0; i < nblocks; i++)
+		if (!strcmp(blocks[i].name, name))
+			return &blocks[i];
+	return NULL;
+}
+
+static char *trim(char *s)
+{
+	char *e;
+
+	while (isspace((unsigned char)*s))
+		s++;
+	e = s + strlen(s);
+	while (e > s && isspace((unsigned char)e[-1]))
+		*--e = 0;
+	return s;
+}
+
+/* split "a, b, c" in place - returns the number of fields */
+static int split_args(char *s, char **args, int max)
+{
+	int n = 0;
+	char *p;
+
+	while (n < max) {
+		p = strchr(s, ',');
+		if (p)
+			*p = 0;
+		args[n++] = trim(s);
+		if (!p)
+			break;
+		s = p + 1;
+	}
+	return n;
+}
+
+static int parse_vals(char **args, int n, unsigned int *vals, const char *file, int line)
+{
+	int i;
+
+	for (i = 0; i < n; i++) {
+		if (sym_value(args[i], &vals[i]) < 0) {
+			fprintf(stderr, "%s:%d: unknown value '%s'\n", file, line, args[i]);
+			return -1;
+		}
+	}
+	return 0;
+}
+
+/* a table entry { op, nid, idx, param, retdata, srcidx }, */
+static int parse_entry(char *s, struct op *o, const char *file, int line)
+{
+	char *args[8];
+	unsigned int v[6];
+	char *e;
+
+	e = strchr(s, '}');
+	if (!e)
+		return -1;
+	*e = 0;
+	if (split_args(s + 1, args, 8) != 6 || parse_vals(args, 6, v, file, line) < 0)
+		return -1;
+	o->op = v[0];
+	o->nid = v[1];
+	o->idx = v[2];
+	o->param = v[3];
+	o->retdata = v[4];
+	o->srcidx = v[5];
+	return 0;
+}
+
+/* one of the replay calls - returns 1 if it was one */
+static int parse_call(const char *fn, char *argstr, struct item *it, const char *file, int line)
+{
+	char *args[10];
+	unsigned int v[10];
+	int n;
+
+	memset(it, 0, sizeof(*it));
+	it->type = ITEM_OP;
+	n = split_args(argstr, args, 10);
+	if (n < 1 || strcmp(args[0], "codec"))
+		return 0;
+
+	if (!strcmp(fn, "snd_hda_coef_item") && n == 7) {
+		if (parse_vals(args + 1, 6, v, file, line) < 0)
+			return -1;
+		it->op = (struct op){ v[0], v[1], v[2], v[3], v[4], v[5] };
+	} else if (!strcmp(fn, "snd_hda_codec_write") && n == 5) {
+		if (parse_vals(args + 1, 4, v, file, line) < 0)
+			return -1;
+		it->op = (struct op){ SEQ_VERB, v[0], v[2], v[3], 0, 0 };
+	} else if (!strcmp(fn, "snd_hda_codec_read_check") && n == 7) {
+		if (parse_vals(args + 1, 6, v, file, line) < 0)
+			return -1;
+		it->op = (struct op){ SEQ_VERB_CHECK, v[0], v[2], v[3], v[4], v[5] };
+	} else if (!strcmp(fn, "hda_set_node_power_state") && n == 3) {
+		if (parse_vals(args + 1, 2, v, file, line) < 0)
+			return -1;
+		it->op = (struct op){ SEQ_POWER, v[0], 0, v[1], 0, 0 };
+	} else if (!strcmp(fn, "cs_8409_vendor_i2cWrite") && n == 5) {
+		if (parse_vals(args + 1, 4, v, file, line) < 0)
+			return -1;
+		it->op = (struct op){ SEQ_I2C_WRITE, v[0], v[1], v[2], v[3], 0 };
+	} else if (!strcmp(fn, "cs_8409_vendor_i2cRead") && n == 4) {
+		if (parse_vals(args + 1, 3, v, file, line) < 0)
+			return -1;
+		it->op = (struct op){ SEQ_I2C_READ, v[0], v[1], 0, v[2], 0 };
+	} else if ((!strcmp(fn, "snd_hda_coef_sequence") || !strcmp(fn, "snd_hda_coef_sequence_probe")) && n >= 2) {
+		it->type = ITEM_TABLE;
+		snprintf(it->name, sizeof(it->name), "%s", args[1]);
+	} else if (!strcmp(fn, "snd_hda_double_reset") && n == 1) {
+		it->type = ITEM_RESET;
+	} else if (n == 1) {
+		it->type = ITEM_CALL;
+		snprintf(it->name, sizeof(it->name), "%s", fn);
+	} else {
+		return 0;
+	}
+	return 1;
+}
+
+static int parse_file(const char *file)
+{
+	FILE *f = fopen(file, "r");
+	char buf[1024], name[96];
+	struct block *cur = NULL;
+	int line = 0;
+
+	if (!f) {
+		perror(file);
+		return -1;
+	}
+
+	while (fgets(buf, sizeof(buf), f)) {
+		char *s, *c, *p;
+		struct item it;
+
+		line++;
+
+		/* block starts and ends are at column 0 */
+		if (sscanf(buf, "static const struct hda_coef %95[A-Za-z0-9_][] = {", name) == 1) {
+			cur = block_new(name, 1);
+			continue;
+		}
+		if (sscanf(buf, "static void %95[A-Za-z0-9_](struct hda_codec *codec%c", name, &name[95]) == 2 &&
+		    !strchr(buf, ';')) {
+			cur = block_new(name, 0);
+			continue;
+		}
+		if (buf[0] == '}') {
+			cur = NULL;
+			continue;
+		}
+		if (!cur)
+			continue;
+
+		s = trim(buf);
+		if (!*s || !strncmp(s, "//", 2))
+			continue;
+		c = strstr(s, "//");
+		if (c)
+			*c = 0;
+		s = trim(s);
+
+		if (cur->is_table) {
+			if (*s != '{')
+				continue;
+			memset(&it, 0, sizeof(it));
+			it.type = ITEM_OP;
+			if (parse_entry(s, &it.op, file, line) < 0) {
+				fprintf(stderr, "%s:%d: bad table entry\n", file, line);
+				return -1;
+			}
+			block_add(cur, &it);
+			continue;
+		}
+
+		/* [lhs = ]fn(args); */
+		p = strchr(s, '(');
+		if (!p || s[strlen(s) - 1] != ';')
+			continue;
+		*p = 0;
+		c = strrchr(p + 1, ')');
+		if (!c)
+			continue;
+		*c = 0;
+		{
+			char *fn = s, *eq = strchr(s, '=');
+
+			if (eq)
+				fn = trim(eq + 1);
+			if (!strcmp(fn, "dev_info") || !strcmp(fn, "printk") || !strcmp(fn, "codec_dbg"))
+				continue;
+			switch (parse_call(trim(fn), p + 1, &it, file, line)) {
+			case 1:
+				block_add(cur, &it);
+				break;
+			case -1:
+				return -1;
+			}
+		}
+	}
+	fclose(f);
+	return 0;
+}
+
+/* ---- expansion ---- */
+
+static int nskipped;
+
+static int expand(const char *name, struct seq *out, int depth)
+{
+	struct block *b = block_find(name);
+	int i;
+
+	if (!b) {
+		fprintf(stderr, "skipped call to %s - not in this file\n", name);
+		nskipped++;
+		return 0;
+	}
+	if (depth > 32) {
+		fprintf(stderr, "%s: calls nested too deep\n", name);
+		return -1;
+	}
+
+	for (i = 0; i < b->n; i++) {
+		struct item *it = &b->items[i];
+		struct op o;
+
+		switch (it->type) {
+		case ITEM_OP:
+			seq_add(out, &it->op);
+			break;
+		case ITEM_TABLE:
+		case ITEM_CALL:
+			if (expand(it->name, out, depth + 1) < 0)
+				return -1;
+			break;
+		case ITEM_RESET:
+			/* snd_hda_double_reset - 0xfff to the afg then 1ms */
+			o = (struct op){ SEQ_VERB, SEQ_AFG, 0xfff, 0, 0, 0 };
+			seq_add(out, &o);
+			o = (struct op){ SEQ_DELAY, 0, 0, 1000, 0, 0 };
+			seq_add(out, &o);
+			break;
+		}
+	}
+	return 0;
+}
+
+/* ---- passes ---- */
+
+struct stats {
+	int i2c_raw;		/* raw coef ops folded into i2c ops */
+	int i2c_ops;		/* i2c ops made */
+	int reads;		/* verification reads dropped */
+	int masks;		/* write masks turned into writes */
+	int setreads;		/* reads of set verbs turned into writes */
+	int dups;		/* redundant writes dropped */
+};
+
+/*
+ * fold raw i2c engine accesses
+ *   write 0x59 = device address
+ *   write 0x5d = reg << 8 | data       register write (reg 0 = page select)
+ *   write 0x5e = reg << 8              register read - data from a read of 0x5e
+ *   read  0x5c                         completion poll
+ * a register 0 write followed by a read or a write of another register is
+ * the page select of a paged access
+ */
+static void fold_i2c(struct seq *in, struct seq *out, struct stats *st)
+{
+	int addr = -1, pend = 0, i;
+	unsigned int pend_reg = 0, pend_data = 0;
+	struct op o;
+
+	for (i = 0; i < in->n; i++) {
+		const struct op *c = &in->ops[i];
+
+		if (c->op <= SEQ_COEF_MASK && c->nid == VENDOR_NID && coef_is_i2c(c->idx) && c->op != SEQ_COEF_MASK) {
+			if (c->op == SEQ_COEF_WRITE && c->idx == 0x59) {
+				if (pend) {
+					o = (struct op){ SEQ_I2C_WRITE, addr, pend_reg, pend_data, 0, c->srcidx };
+					seq_add(out, &o);
+					st->i2c_ops++;
+					pend = 0;
+				}
+				addr = c->param;
+				st->i2c_raw++;
+				continue;
+			}
+			if (addr >= 0 && c->op == SEQ_COEF_WRITE && c->idx == 0x5d) {
+				unsigned int reg = (c->param >> 8) & 0xff, data = c->param & 0xff;
+
+				if (pend && pend_reg == 0 && reg != 0) {
+					/* paged write */
+					o = (struct op){ SEQ_I2C_WRITE, addr, pend_data << 8 | reg, data, 1, c->srcidx };
+					seq_add(out, &o);
+					st->i2c_ops++;
+					pend = 0;
+				} else {
+					if (pend) {
+						o = (struct op){ SEQ_I2C_WRITE, addr, pend_reg, pend_data, 0, c->srcidx };
+						seq_add(out, &o);
+						st->i2c_ops++;
+					}
+					pend = 1;
+					pend_reg = reg;
+					pend_data = data;
+				}
+				st->i2c_raw++;
+				continue;
+			}
+			if (addr >= 0 && c->op == SEQ_COEF_WRITE && c->idx == 0x5e) {
+				unsigned int reg = (c->param >> 8) & 0xff;
+
+				if (pend && pend_reg == 0) {
+					o = (struct op){ SEQ_I2C_READ, addr, pend_data << 8 | reg, 0, 1, c->srcidx };
+				} else {
+					if (pend) {
+						o = (struct op){ SEQ_I2C_WRITE, addr, pend_reg, pend_data, 0, c->srcidx };
+						seq_add(out, &o);
+						st->i2c_ops++;
+					}
+					o = (struct op){ SEQ_I2C_READ, addr, reg, 0, 0, c->srcidx };
+				}
+				pend = 0;
+				seq_add(out, &o);
+				st->i2c_ops++;
+				st->i2c_raw++;
+				continue;
+			}
+			if (c->op == SEQ_COEF_READ) {
+				/* polls and the read data - part of the transaction */
+				st->i2c_raw++;
+				continue;
+			}
+		}
+
+		if (pend) {
+			o = (struct op){ SEQ_I2C_WRITE, addr, pend_reg, pend_data, 0, c->srcidx };
+			seq_add(out, &o);
+			st->i2c_ops++;
+			pend = 0;
+		}
+		seq_add(out, c);
+	}
+	if (pend) {
+		o = (struct op){ SEQ_I2C_WRITE, addr, pend_reg, pend_data, 0, 0 };
+		seq_add(out, &o);
+		st->i2c_ops++;
+	}
+}
+
+static void strip_reads(struct seq *in, struct seq *out, struct stats *st)
+{
+	int i;
+
+	for (i = 0; i < in->n; i++) {
+		struct op o = in->ops[i];
+
+		if (o.op == SEQ_COEF_READ) {
+			st->reads++;
+			continue;
+		}
+		if (o.op == SEQ_COEF_MASK) {
+			o.op = SEQ_COEF_WRITE;
+			st->masks++;
+		}
+		if (o.op == SEQ_VERB_CHECK) {
+			if (verb_must_read(o.idx)) {
+				seq_add(out, &o);
+				continue;
+			}
+			if (verb_is_get(o.idx)) {
+				st->reads++;
+				continue;
+			}
+			o.op = SEQ_VERB;
+			o.retdata = 0;
+			st->setreads++;
+		}
+		seq_add(out, &o);
+	}
+}
+
+/* ---- register model ---- */
+
+struct state_ent {
+	unsigned int key[3];
+	unsigned int val;
+};
+
+struct state {
+	struct state_ent *e;
+	int n, alloc;
+};
+
+static struct state_ent *state_find(struct state *s, unsigned int k0, unsigned int k1, unsigned int k2)
+{
+	int i;
+
+	for (i = 0; i < s->n; i++)
+		if (s->e[i].key[0] == k0 && s->e[i].key[1] == k1 && s->e[i].key[2] == k2)
+			return &s->e[i];
+	return NULL;
+}
+
+static void state_set(struct state *s, unsigned int k0, unsigned int k1, unsigned int k2, unsigned int val)
+{
+	struct state_ent *e = state_find(s, k0, k1, k2);
+
+	if (!e) {
+		if (s->n == s->alloc) {
+			s->alloc = s->alloc ? s->alloc * 2 : 256;
+			s->e = realloc(s->e, s->alloc * sizeof(*s->e));
+			if (!s->e) {
+				perror("realloc");
+				exit(1);
+			}
+		}
+		e = &s->e[s->n++];
+		e->key[0] = k0;
+		e->key[1] = k1;
+		e->key[2] = k2;
+	}
+	e->val = val;
+}
+
+static void state_drop(struct state *s, unsigned int k0, unsigned int k1, unsigned int k2)
+{
+	struct state_ent *e = state_find(s, k0, k1, k2);
+
+	if (e)
+		*e = s->e[--s->n];
+}
+
+enum { K_COEF, K_VERB, K_I2C };
+
+/* state key of a write - returns 0 if the op does not latch a value */
+static int op_key(const struct op *o, unsigned int *k0, unsigned int *k1, unsigned int *k2, unsigned int *val)
+{
+	switch (o->op) {
+	case SEQ_COEF_WRITE:
+	case SEQ_COEF_MASK:
+		if (!coef_is_latch(o->idx))
+			return 0;
+		*k0 = K_COEF;
+		*k1 = o->nid;
+		*k2 = o->idx;
+		*val = o->param;
+		return 1;
+	case SEQ_VERB:
+	case SEQ_VERB_CHECK:
+		if (!verb_is_latch(o->idx))
+			return 0;
+		*k0 = K_VERB;
+		*k1 = o->nid;
+		/* amp gain/mute is addressed by the direction/index bits of the payload */
+		*k2 = o->idx == 0x300 ? (0x300 << 16 | (o->param & 0xff00)) : o->idx << 16;
+		*val = o->idx == 0x300 ? (o->param & 0xff) : o->param;
+		return 1;
+	case SEQ_POWER:
+		*k0 = K_VERB;
+		*k1 = o->nid;
+		*k2 = 0x705 << 16;
+		*val = o->param;
+		return 1;
+	case SEQ_I2C_WRITE:
+		*k0 = K_I2C;
+		*k1 = o->nid;
+		*k2 = o->retdata ? o->idx : (o->idx & 0xff);
+		*val = o->param;
+		return 1;
+	}
+	return 0;
+}
+
+/* what a sequence does to the model */
+static void model_apply(struct state *s, const struct op *o, int trust_reads)
+{
+	unsigned int k0, k1, k2, val;
+
+	if ((o->op == SEQ_VERB || o->op == SEQ_VERB_CHECK) && verb_is_reset(o->idx)) {
+		s->n = 0;
+		return;
+	}
+	if (o->op == SEQ_I2C_WRITE || o->op == SEQ_I2C_READ) {
+		/* the driver i2c ops switch the i2c clock in coef 0 themselves */
+		state_drop(s, K_COEF, VENDOR_NID, 0);
+		/* a paged access also writes register 0 */
+		if (o->retdata)
+			state_set(s, K_I2C, o->nid, 0, (o->idx >> 8) & 0xff);
+	}
+	if (trust_reads && o->op == SEQ_COEF_READ && coef_is_latch(o->idx)) {
+		state_set(s, K_COEF, o->nid, o->idx, o->retdata);
+		return;
+	}
+	if (trust_reads && o->op == SEQ_VERB_CHECK && verb_is_get(o->idx) &&
+	    verb_is_latch(o->idx & 0x7ff) && (o->idx & 0xf00) == 0xf00) {
+		/* GET_xxx 0xfNN reads back what SET_xxx 0x7NN latched */
+		state_set(s, K_VERB, o->nid, (o->idx & 0x7ff) << 16, o->retdata);
+		return;
+	}
+	if (op_key(o, &k0, &k1, &k2, &val))
+		state_set(s, k0, k1, k2, val);
+}
+
+static void drop_dups(struct seq *in, struct seq *out, int trust_reads, struct stats *st)
+{
+	struct state s = { 0 };
+	unsigned int k0, k1, k2, val;
+	int i;
+
+	for (i = 0; i < in->n; i++) {
+		const struct op *o = &in->ops[i];
+		struct state_ent *e;
+
+		if (o->op != SEQ_I2C_WRITE && op_key(o, &k0, &k1, &k2, &val)) {
+			e = state_find(&s, k0, k1, k2);
+			if (e && e->val == val) {
+				st->dups++;
+				continue;
+			}
+		}
+		model_apply(&s, o, trust_reads);
+		seq_add(out, o);
+	}
+	free(s.e);
+}
+
+/* compare the final write state of two sequences */
+static int check_equivalent(struct seq *a, struct seq *b)
+{
+	struct state sa = { 0 }, sb = { 0 };
+	int i, bad = 0;
+
+	for (i = 0; i < a->n; i++)
+		model_apply(&sa, &a->ops[i], 0);
+	for (i = 0; i < b->n; i++)
+		model_apply(&sb, &b->ops[i], 0);
+
+	/* coef 0 is left to the i2c clock handling - compare only if both know it */
+	for (i = 0; i < sa.n; i++) {
+		struct state_ent *e = state_find(&sb, sa.e[i].key[0], sa.e[i].key[1], sa.e[i].key[2]);
+
+		if (!e || e->val != sa.e[i].val) {
+			fprintf(stderr, "final state differs: kind %u nid 0x%02x key 0x%x 0x%x vs %s%x\n",
+				sa.e[i].key[0], sa.e[i].key[1], sa.e[i].key[2], sa.e[i].val,
+				e ? "0x" : "unset ", e ? e->val : 0);
+			bad++;
+		}
+	}
+	for (i = 0; i < sb.n; i++) {
+		if (!state_find(&sa, sb.e[i].key[0], sb.e[i].key[1], sb.e[i].key[2])) {
+			fprintf(stderr, "final state differs: kind %u nid 0x%02x key 0x%x only in optimized\n",
+				sb.e[i].key[0], sb.e[i].key[1], sb.e[i].key[2]);
+			bad++;
+		}
+	}
+	free(sa.e);
+	free(sb.e);
+	return bad;
+}
+
+/* ---- output ---- */
+
+/* estimated HDA verbs - coef accesses at the Apple 4 verbs each */
+static int op_cost(const struct op *o)
+{
+	switch (o->op) {
+	case SEQ_COEF_READ:
+	case SEQ_COEF_WRITE:
+		return 4;
+	case SEQ_COEF_MASK:
+		return 8;
+	case SEQ_VERB:
+	case SEQ_VERB_CHECK:
+	case SEQ_POWER:
+		return 1;
+	case SEQ_I2C_WRITE:
+		/* proc state, clock on/off, address, data, one poll */
+		return 2 + 8 + 4 + 4 + 4 + (o->retdata ? 8 : 0);
+	case SEQ_I2C_READ:
+		return 2 + 8 + 4 + 4 + 8 + 4 + (o->retdata ? 8 : 0);
+	}
+	return 0;
+}
+
+static int seq_cost(const struct seq *s)
+{
+	int i, c = 0;
+
+	for (i = 0; i < s->n; i++)
+		c += op_cost(&s->ops[i]);
+	return c;
+}
+
+static const char * const op_names[SEQ_NOPS] = {
+	"0", "1", "2", "CS8409_SEQ_VERB", "CS8409_SEQ_VERB_CHECK", "CS8409_SEQ_POWER",
+	"CS8409_SEQ_I2C_WRITE", "CS8409_SEQ_I2C_READ", "CS8409_SEQ_DELAY",
+};
+
+static void print_nid(FILE *f, const struct op *o)
+{
+	if (o->op == SEQ_I2C_WRITE || o->op == SEQ_I2C_READ || o->op == SEQ_DELAY)
+		fprintf(f, "0x%02x", o->nid);
+	else if (o->nid == SEQ_AFG)
+		fprintf(f, "CS8409_SEQ_AFG");
+	else if (o->nid == VENDOR_NID)
+		fprintf(f, "CS8409_VENDOR_NID");
+	else
+		fprintf(f, "0x%02x", o->nid);
+}
+
+static void emit_table(FILE *f, const char *name, const struct seq *s)
+{
+	int i;
+
+	fprintf(f, "// generated by tools/cs8409_seqopt from %s\n", name);
+	fprintf(f, "static const struct hda_coef %s_opt[] = {\n", name);
+	for (i = 0; i < s->n; i++) {
+		const struct op *o = &s->ops[i];
+		const char *vn = NULL;
+
+		fprintf(f, "        { %s, ", o->op < SEQ_NOPS ? op_names[o->op] : "?");
+		print_nid(f, o);
+		if (o->op == SEQ_VERB || o->op == SEQ_VERB_CHECK)
+			vn = verb_name(o->idx);
+		if (o->op == SEQ_POWER)
+			fprintf(f, ", 0, AC_PWRST_D%u, 0x%08x, %u },\n", o->param, o->retdata, o->srcidx);
+		else if (vn)
+			fprintf(f, ", %s, 0x%04x, 0x%08x, %u },\n", vn, o->param, o->retdata, o->srcidx);
+		else
+			fprintf(f, ", 0x%04x, 0x%04x, 0x%08x, %u },\n", o->idx, o->param, o->retdata, o->srcidx);
+	}
+	fprintf(f, "};\n");
+}
+
+static void put16(FILE *f, unsigned int v)
+{
+	fputc(v & 0xff, f);
+	fputc((v >> 8) & 0xff, f);
+}
+
+static void put32(FILE *f, unsigned int v)
+{
+	put16(f, v & 0xffff);
+	put16(f, v >> 16);
+}
+
+static int emit_fw(const char *path, const struct seq *s, int type, unsigned int subsys)
+{
+	FILE *f = fopen(path, "wb");
+	int i;
+
+	if (!f) {
+		perror(path);
+		return -1;
+	}
+	put32(f, FW_MAGIC);
+	put16(f, FW_VERSION);
+	put16(f, 1);
+	put32(f, subsys);
+	put16(f, type);
+	put16(f, 0);
+	put32(f, s->n);
+	for (i = 0; i < s->n; i++) {
+		const struct op *o = &s->ops[i];
+
+		fputc(o->op, f);
+		fputc(o->nid, f);
+		put16(f, o->idx);
+		put16(f, o->param);
+		put32(f, o->retdata);
+		put16(f, o->srcidx);
+	}
+	return fclose(f);
+}
+
+static void usage(void)
+{
+	fprintf(stderr,
+		"usage: cs8409_seqopt [-r] [-c] [-o table.h] [-b out.bin -t boot|play|playstop -i subsystem_id]\n"
+		"                     header.h table_or_function\n"
+		"  -r  trust the logged read values as the register state\n"
+		"  -c  check the final register state of the optimized sequence\n");
+	exit(2);
+}
+
+int main(int argc, char **argv)
+{
+	struct seq raw = { 0 }, folded = { 0 }, noreads = { 0 }, opt = { 0 };
+	struct stats st = { 0 };
+	const char *outpath = NULL, *fwpath = NULL;
+	unsigned int subsys = 0;
+	int trust_reads = 0, check = 0, fwtype = -1;
+	int c, in_cost, out_cost;
+	FILE *out = stdout;
+
+	while ((c = getopt(argc, argv, "rco:b:t:i:")) != -1) {
+		switch (c) {
+		case 'r':
+			trust_reads = 1;
+			break;
+		case 'c':
+			check = 1;
+			break;
+		case 'o':
+			outpath = optarg;
+			break;
+		case 'b':
+			fwpath = optarg;
+			break;
+		case 't':
+			if (!strcmp(optarg, "boot"))
+				fwtype = 0;
+			else if (!strcmp(optarg, "play"))
+				fwtype = 1;
+			else if (!strcmp(optarg, "playstop"))
+				fwtype = 2;
+			else
+				usage();
+			break;
+		case 'i':
+			subsys = strtoul(optarg, NULL, 16);
+			break;
+		default:
+			usage();
+		}
+	}
+	if (argc - optind != 2 || (fwpath && (fwtype < 0 || !subsys)))
+		usage();
+
+	if (parse_file(argv[optind]) < 0)
+		return 1;
+	if (!block_find(argv[optind + 1])) {
+		fprintf(stderr, "%s: no table or function %s\n", argv[optind], argv[optind + 1]);
+		return 1;
+	}
+	if (expand(argv[optind + 1], &raw, 0) < 0)
+		return 1;
+
+	fold_i2c(&raw, &folded, &st);
+	strip_reads(&folded, &noreads, &st);
+	drop_dups(&noreads, &opt, trust_reads, &st);
+
+	if (outpath) {
+		out = fopen(outpath, "w");
+		if (!out) {
+			perror(outpath);
+			return 1;
+		}
+	}
+	emit_table(out, argv[optind + 1], &opt);
+	if (out != stdout)
+		fclose(out);
+
+	if (fwpath && emit_fw(fwpath, &opt, fwtype, subsys) < 0)
+		return 1;
+
+	in_cost = seq_cost(&raw);
+	out_cost = seq_cost(&opt);
+	fprintf(stderr, "%s: %d ops -> %d ops\n", argv[optind + 1], raw.n, opt.n);
+	fprintf(stderr, "  i2c: %d raw coef ops folded into %d i2c ops\n", st.i2c_raw, st.i2c_ops);
+	fprintf(stderr, "  verification reads dropped: %d\n", st.reads);
+	fprintf(stderr, "  write masks made writes: %d  set verb reads made writes: %d\n", st.masks, st.setreads);
+	fprintf(stderr, "  redundant writes dropped: %d%s\n", st.dups, trust_reads ? " (trusting logged reads)" : "");
+	if (nskipped)
+		fprintf(stderr, "  calls not expanded: %d\n", nskipped);
+	fprintf(stderr, "  estimated hda verbs: %d -> %d (%d saved)\n", in_cost, out_cost, in_cost - out_cost);
+
+	if (check) {
+		int bad = check_equivalent(&folded, &opt);
+
+		if (trust_reads)
+			fprintf(stderr, "  note: -r assumes the codec matches the logged reads\n");
+		fprintf(stderr, "  final register state: %s\n", bad ? "DIFFERS" : "same");
+		if (bad)
+			return 1;
+	}
+	return 0;
+}